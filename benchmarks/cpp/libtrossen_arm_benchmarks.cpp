@@ -0,0 +1,398 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// This program benchmarks the driver end to end and reports the results in JSON.
+//
+// Hardware setup:
+// 1. One or more WXAI V0 arms, with ips given on the command line
+//
+// The program does the following:
+// 1. Measures the latency of configure() and cleanup() on the first arm
+// 2. Configures all arms and puts them in position mode, holding their current positions
+// 3. Measures the daemon cycle rate and jitter of every arm concurrently
+// 4. Measures the getter throughput with an increasing number of reader threads
+// 5. Measures the latency of set_all_positions() with goal times of 0.0s, 0.1s, and 2.0s
+// 6. Measures the latency of set_cartesian_positions() and the daemon cycle time while a
+//    Cartesian-space trajectory is evaluated
+// 7. Restores the original modes of all arms
+// 8. Prints the results in JSON to the standard output or writes them to a file
+// NOTE: Every command targets the current positions, so the arms should not move. Still, please
+// keep the arms clear of obstacles while the program is running.
+
+#include <cstdint>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm.hpp"
+#include "libtrossen_arm/trossen_arm_publisher.hpp"
+#include "libtrossen_arm/trossen_arm_statistics.hpp"
+
+namespace
+{
+
+// Minimal JSON object builder keeping the insertion order of the members
+class JsonObject
+{
+public:
+  JsonObject & add(const std::string & key, double value)
+  {
+    std::ostringstream stream;
+    stream.precision(9);
+    stream << value;
+    members_.emplace_back(key, stream.str());
+    return *this;
+  }
+
+  JsonObject & add(const std::string & key, uint64_t value)
+  {
+    members_.emplace_back(key, std::to_string(value));
+    return *this;
+  }
+
+  JsonObject & add(const std::string & key, const std::string & value)
+  {
+    members_.emplace_back(key, "\"" + value + "\"");
+    return *this;
+  }
+
+  JsonObject & add(const std::string & key, const JsonObject & value)
+  {
+    members_.emplace_back(key, value.dump());
+    return *this;
+  }
+
+  JsonObject & add(const std::string & key, const std::vector<JsonObject> & values)
+  {
+    std::string array{"["};
+    for (size_t i = 0; i < values.size(); ++i) {
+      array += (i == 0 ? "" : ",") + values[i].dump();
+    }
+    members_.emplace_back(key, array + "]");
+    return *this;
+  }
+
+  std::string dump() const
+  {
+    std::string object{"{"};
+    for (size_t i = 0; i < members_.size(); ++i) {
+      object += (i == 0 ? "\"" : ",\"") + members_[i].first + "\":" + members_[i].second;
+    }
+    return object + "}";
+  }
+
+private:
+  std::vector<std::pair<std::string, std::string>> members_{};
+};
+
+struct Options
+{
+  std::vector<std::string> ips{};
+  std::string output{};
+  double duration{5.0};
+  int configure_repetitions{5};
+};
+
+JsonObject to_json(const trossen_arm::LatencySummary & summary)
+{
+  return JsonObject()
+    .add("count", summary.count)
+    .add("min", summary.min)
+    .add("mean", summary.mean)
+    .add("p50", summary.p50)
+    .add("p99", summary.p99)
+    .add("p999", summary.p999)
+    .add("max", summary.max);
+}
+
+JsonObject to_json(const trossen_arm::CycleStatistics & cycle_statistics)
+{
+  return JsonObject()
+    .add("cycle_time", to_json(cycle_statistics.cycle_time))
+    .add("update_interval", to_json(cycle_statistics.update_interval))
+    .add("read_time", to_json(cycle_statistics.read_time))
+    .add("num_cycles", cycle_statistics.num_cycles)
+    .add("num_overruns", cycle_statistics.num_overruns)
+    .add("num_id_resets", cycle_statistics.num_id_resets);
+}
+
+// Time a function repeatedly and summarize the latencies
+trossen_arm::LatencySummary time_calls(int repetitions, const std::function<void()> & function)
+{
+  trossen_arm::LatencyHistogram histogram;
+  for (int i = 0; i < repetitions; ++i) {
+    auto start_time = std::chrono::steady_clock::now();
+    function();
+    histogram.record(
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count()
+    );
+  }
+  return histogram.get_summary();
+}
+
+void configure(trossen_arm::TrossenArmDriver & driver, const std::string & ip)
+{
+  driver.configure(
+    trossen_arm::Model::wxai_v0,
+    trossen_arm::StandardEndEffector::wxai_v0_base,
+    ip,
+    false
+  );
+}
+
+JsonObject benchmark_configure(const Options & options)
+{
+  trossen_arm::LatencyHistogram configure_histogram;
+  trossen_arm::LatencyHistogram cleanup_histogram;
+  trossen_arm::TrossenArmDriver driver;
+  for (int i = 0; i < options.configure_repetitions; ++i) {
+    auto start_time = std::chrono::steady_clock::now();
+    configure(driver, options.ips.front());
+    auto configured_time = std::chrono::steady_clock::now();
+    driver.cleanup();
+    auto cleaned_up_time = std::chrono::steady_clock::now();
+    configure_histogram.record(std::chrono::duration<double>(configured_time - start_time).count());
+    cleanup_histogram.record(
+      std::chrono::duration<double>(cleaned_up_time - configured_time).count()
+    );
+  }
+  return JsonObject()
+    .add("configure", to_json(configure_histogram.get_summary()))
+    .add("cleanup", to_json(cleanup_histogram.get_summary()));
+}
+
+JsonObject benchmark_cycles(
+  std::vector<std::unique_ptr<trossen_arm::TrossenArmDriver>> & drivers,
+  const Options & options
+)
+{
+  std::vector<std::unique_ptr<trossen_arm::RobotOutputPublisher>> publishers;
+  for (auto & driver : drivers) {
+    publishers.push_back(std::make_unique<trossen_arm::RobotOutputPublisher>(*driver, 0.0001));
+  }
+  std::this_thread::sleep_for(std::chrono::duration<double>(options.duration));
+  std::vector<JsonObject> arms;
+  for (size_t i = 0; i < drivers.size(); ++i) {
+    arms.push_back(
+      JsonObject()
+      .add("ip", options.ips[i])
+      .add("statistics", to_json(publishers[i]->get_cycle_statistics()))
+    );
+  }
+  return JsonObject().add("num_arms", uint64_t{drivers.size()}).add("arms", arms);
+}
+
+JsonObject benchmark_getters(trossen_arm::TrossenArmDriver & driver, const Options & options)
+{
+  std::vector<JsonObject> results;
+  for (int num_threads : {1, 2, 4, 8}) {
+    for (bool reuse_buffer : {false, true}) {
+      std::atomic<bool> running{true};
+      std::atomic<uint64_t> num_calls{0};
+      std::vector<std::thread> threads;
+      for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back(
+          [&driver, &running, &num_calls, reuse_buffer]() {
+            std::vector<double> positions(driver.get_num_joints());
+            uint64_t local_num_calls{0};
+            while (running.load(std::memory_order_relaxed)) {
+              if (reuse_buffer) {
+                driver.get_all_positions(positions);
+              } else {
+                positions = driver.get_all_positions();
+              }
+              ++local_num_calls;
+            }
+            num_calls.fetch_add(local_num_calls);
+          }
+        );
+      }
+      trossen_arm::RobotOutputPublisher publisher(driver, 0.0001);
+      std::this_thread::sleep_for(std::chrono::duration<double>(options.duration));
+      running.store(false);
+      for (auto & thread : threads) {
+        thread.join();
+      }
+      results.push_back(
+        JsonObject()
+        .add("num_threads", uint64_t(num_threads))
+        .add("overload", std::string(reuse_buffer ? "output_argument" : "return_value"))
+        .add("calls_per_second", num_calls.load() / options.duration)
+        .add("daemon", to_json(publisher.get_cycle_statistics()))
+      );
+    }
+  }
+  return JsonObject().add("get_all_positions", results);
+}
+
+JsonObject benchmark_setters(trossen_arm::TrossenArmDriver & driver)
+{
+  JsonObject results;
+  std::vector<double> positions(driver.get_num_joints());
+  driver.get_all_positions(positions);
+  for (auto [name, goal_time, repetitions] : {
+      std::tuple<std::string, double, int>{"goal_time_0.0", 0.0, 1000},
+      std::tuple<std::string, double, int>{"goal_time_0.1", 0.1, 1000},
+      std::tuple<std::string, double, int>{"goal_time_2.0_blocking", 2.0, 3}})
+  {
+    bool blocking = goal_time > 1.0;
+    results.add(
+      name,
+      to_json(
+        time_calls(
+          repetitions,
+          [&driver, &positions, goal_time, blocking]() {
+            driver.set_all_positions(positions, goal_time, blocking);
+          }
+        )
+      )
+    );
+  }
+  return JsonObject().add("set_all_positions", results);
+}
+
+JsonObject benchmark_cartesian(trossen_arm::TrossenArmDriver & driver, const Options & options)
+{
+  std::array<double, 6> cartesian_positions = driver.get_cartesian_positions();
+  JsonObject results;
+  for (auto interpolation_space :
+    {trossen_arm::InterpolationSpace::joint, trossen_arm::InterpolationSpace::cartesian})
+  {
+    trossen_arm::RobotOutputPublisher publisher(driver, 0.0001);
+    auto call_latency = time_calls(
+      1000,
+      [&driver, &cartesian_positions, interpolation_space]() {
+        driver.set_cartesian_positions(cartesian_positions, interpolation_space, 0.1, false);
+      }
+    );
+    // Evaluate one long trajectory to measure the daemon cycle time under interpolation
+    publisher.reset_cycle_statistics();
+    driver.set_cartesian_positions(
+      cartesian_positions,
+      interpolation_space,
+      options.duration,
+      true
+    );
+    results.add(
+      interpolation_space == trossen_arm::InterpolationSpace::joint ? "joint" : "cartesian",
+      JsonObject()
+      .add("set_cartesian_positions", to_json(call_latency))
+      .add("daemon", to_json(publisher.get_cycle_statistics()))
+    );
+  }
+  return JsonObject().add("set_cartesian_positions", results);
+}
+
+bool parse_options(int argc, char ** argv, Options & options)
+{
+  for (int i = 1; i < argc; ++i) {
+    std::string argument{argv[i]};
+    if (argument == "--output" && i + 1 < argc) {
+      options.output = argv[++i];
+    } else if (argument == "--duration" && i + 1 < argc) {
+      options.duration = std::stod(argv[++i]);
+    } else if (argument == "--configure-repetitions" && i + 1 < argc) {
+      options.configure_repetitions = std::stoi(argv[++i]);
+    } else if (!argument.empty() && argument.front() != '-') {
+      options.ips.push_back(argument);
+    } else {
+      return false;
+    }
+  }
+  return !options.ips.empty() && options.duration > 0.0;
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  Options options;
+  if (!parse_options(argc, argv, options)) {
+    std::cerr << "Usage: " << argv[0]
+              << " [--output FILE] [--duration SECONDS] [--configure-repetitions N] IP [IP ...]"
+              << std::endl;
+    return 1;
+  }
+
+  JsonObject report;
+
+  std::cerr << "Benchmarking configure() and cleanup()..." << std::endl;
+  report.add("configure", benchmark_configure(options));
+
+  std::cerr << "Configuring the drivers..." << std::endl;
+  std::vector<std::unique_ptr<trossen_arm::TrossenArmDriver>> drivers;
+  std::vector<std::vector<trossen_arm::Mode>> modes;
+  for (const auto & ip : options.ips) {
+    drivers.push_back(std::make_unique<trossen_arm::TrossenArmDriver>());
+    configure(*drivers.back(), ip);
+    modes.push_back(drivers.back()->get_modes());
+    drivers.back()->set_all_modes(trossen_arm::Mode::position);
+  }
+  trossen_arm::TrossenArmDriver & driver = *drivers.front();
+  report
+  .add("driver_version", driver.get_driver_version())
+  .add("controller_version", driver.get_controller_version());
+
+  std::cerr << "Benchmarking the daemon cycles..." << std::endl;
+  report.add("cycles", benchmark_cycles(drivers, options));
+
+  std::cerr << "Benchmarking the getters..." << std::endl;
+  report.add("getters", benchmark_getters(driver, options));
+
+  std::cerr << "Benchmarking the setters..." << std::endl;
+  report.add("setters", benchmark_setters(driver));
+
+  std::cerr << "Benchmarking the Cartesian interpolation..." << std::endl;
+  report.add("cartesian", benchmark_cartesian(driver, options));
+
+  std::cerr << "Restoring the modes..." << std::endl;
+  for (size_t i = 0; i < drivers.size(); ++i) {
+    drivers[i]->set_joint_modes(modes[i]);
+  }
+
+  if (options.output.empty()) {
+    std::cout << report.dump() << std::endl;
+  } else {
+    std::ofstream(options.output) << report.dump() << std::endl;
+    std::cerr << "Results written to " << options.output << std::endl;
+  }
+
+  return 0;
+}
@@ -38,22 +38,26 @@
 // 2. Configures the drivers with the leader and follower configurations
 // 3. Records the sleep positions
 // 4. Moves the robots to home positions
-// 5. For a specified amount of time, feeds the external efforts from the follower robot to the
-//    leader robot and feeds the positions from the leader robot to the follower robot
+// 5. For a specified amount of time, runs a teleoperation that feeds the external efforts from the
+//    follower robot to the leader robot and the positions from the leader robot to the follower
+//    robot
 // 6. Moves the robots to home positions
 // 7. Moves the robots to sleep positions
 // 8. Sets the robots to idle mode
 // 9. The driver automatically sets the mode to idle at the destructor
+// If the teleoperation fails, steps 6 to 8 still run before the script exits with an error.
 // NOTE: When the time for teleoperation has expired, it will get locked in position and start
 // moving to home positions. Please let go of the leader when this happens.
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <thread>
 #include <vector>
 
 #include "libtrossen_arm/trossen_arm.hpp"
+#include "libtrossen_arm/trossen_arm_teleoperation.hpp"
 
 int main(int argc, char ** argv)
 {
@@ -86,24 +90,33 @@ int main(int argc, char ** argv)
   driver_leader.set_all_modes(trossen_arm::Mode::external_effort);
   driver_follower.set_all_modes(trossen_arm::Mode::position);
 
-  auto start_time = std::chrono::steady_clock::now();
-  auto end_time = start_time + std::chrono::seconds(20);
-  double force_feedback_gain = 0.1;
-  std::vector<double> external_efforts_leader(driver_leader.get_num_joints());
-  while (std::chrono::steady_clock::now() < end_time) {
-    // Feed the external external efforts from the follower robot to the leader robot
-    external_efforts_leader = driver_follower.get_all_external_efforts();
-    for (size_t i = 0; i < driver_leader.get_num_joints(); ++i) {
-      external_efforts_leader.at(i) *= -force_feedback_gain;
+  bool failed{false};
+  {
+    // Feed the external efforts from the follower robot to the leader robot and the positions
+    // from the leader robot to the follower robot on every new leader robot output
+    trossen_arm::TeleoperationConfiguration configuration;
+    configuration.force_feedback_gain = 0.1;
+    trossen_arm::Teleoperation teleoperation(driver_leader, driver_follower, configuration);
+    // Check every second that the teleoperation is still running
+    uint64_t num_updates{0};
+    try {
+      for (int i = 0; i < 20; ++i) {
+        std::this_thread::sleep_for(std::chrono::seconds(1));
+        const uint64_t num_updates_new = teleoperation.get_num_updates();
+        if (num_updates_new == num_updates) {
+          std::cout << "The teleoperation stopped updating, stopping early..." << std::endl;
+          break;
+        }
+        num_updates = num_updates_new;
+      }
+    } catch (const std::exception & e) {
+      std::cout << "The teleoperation failed: " << e.what() << std::endl;
+      std::cout << "Leader error information: " << driver_leader.get_error_information()
+                << std::endl;
+      std::cout << "Follower error information: " << driver_follower.get_error_information()
+                << std::endl;
+      failed = true;
     }
-    driver_leader.set_all_external_efforts(external_efforts_leader, 0.0f, false);
-    // Feed the positions from the leader robot to the follower robot
-    driver_follower.set_all_positions(
-      driver_leader.get_all_positions(),
-      0.0f,
-      false,
-      driver_leader.get_all_velocities()
-    );
   }
 
   std::cout << "Moving to home positions..." << std::endl;
@@ -120,5 +133,9 @@ int main(int argc, char ** argv)
   driver_follower
     .set_all_positions(std::vector<double>(driver_leader.get_num_joints(), 0.0), 2.0f, true);
 
-  return 0;
+  std::cout << "Setting the robots to idle mode..." << std::endl;
+  driver_leader.set_all_modes(trossen_arm::Mode::idle);
+  driver_follower.set_all_modes(trossen_arm::Mode::idle);
+
+  return failed ? 1 : 0;
 }
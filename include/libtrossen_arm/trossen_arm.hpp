@@ -29,10 +29,21 @@
 #ifndef LIBTROSSEN_ARM__TROSSEN_ARM_HPP_
 #define LIBTROSSEN_ARM__TROSSEN_ARM_HPP_
 
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+
+#include <cerrno>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <chrono>
+#include <exception>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -75,6 +86,51 @@ public:
     double timeout = 20.0
   );
 
+  /**
+   * @brief Configure the driver and apply the scheduling options of the daemon thread
+   *
+   * @param model Model of the robot
+   * @param end_effector End effector properties
+   * @param serv_ip IP address of the robot
+   * @param clear_error Whether to clear the error state of the robot
+   * @param daemon_options Scheduling options of the daemon thread
+   * @param timeout Timeout for connection to the arm controller's TCP server in seconds, default is
+   * 20.0s
+   * @return Descriptions of the options that could not be applied, empty if all were applied,
+   * see set_daemon_options()
+   *
+   * @note This function calls configure() and then set_daemon_options() internally
+   */
+  std::vector<std::string> configure(
+    Model model,
+    EndEffector end_effector,
+    const std::string serv_ip,
+    bool clear_error,
+    const DaemonOptions & daemon_options,
+    double timeout = 20.0
+  );
+
+  /**
+   * @brief Apply scheduling options to the running daemon thread
+   *
+   * @param daemon_options Scheduling options of the daemon thread
+   * @return Descriptions of the options that could not be applied, empty if all were applied
+   *
+   * @details Every option is attempted. An option that cannot be applied, e.g. for lack of
+   * privileges, is not fatal: the driver keeps running with the default for it, the other options
+   * staying applied, and the failure is returned for the caller to report or act upon.
+   * A LogicError is thrown only for an invalid priority or CPU index, before any option is
+   * applied.
+   *
+   * @note Real-time priorities usually require the CAP_SYS_NICE capability or a matching
+   * rtprio limit in /etc/security/limits.conf, and memory locking requires CAP_IPC_LOCK or a
+   * sufficient memlock limit
+   *
+   * @note cleanup() and clear_error() restart the daemon thread with the default scheduling, so
+   * the options should be applied again after configuring the driver again
+   */
+  std::vector<std::string> set_daemon_options(const DaemonOptions & daemon_options);
+
   /**
    * @brief Cleanup the driver
    *
@@ -132,6 +188,39 @@ public:
     const std::optional<std::vector<double>> & goal_feedforward_accelerations = std::nullopt
   );
 
+  /**
+   * @brief Get the minimum goal time of set_all_positions() within the joint limits
+   *
+   * @param goal_positions Positions in rad for arm joints and m for the gripper joint
+   * @param velocity_scaling Optional: fraction of JointLimit::velocity_max to reach at most,
+   * default 1.0
+   * @param accelerations_max Optional: maximum accelerations in rad/s^2 for arm joints and m/s^2
+   * for the gripper joint, unlimited if empty
+   * @return Goal time in s
+   *
+   * @details The goal time is the shortest one for which the quintic rest-to-rest trajectory of
+   * every joint stays within the velocity limit, peaking at 15/8 of the mean velocity, and within
+   * the acceleration limit, peaking at 10/sqrt(3) times the distance over the squared goal time.
+   * Since all joints share the goal time, they start and finish together, and the slowest joint
+   * runs at its limit.
+   *
+   * @note The size of the vectors should be equal to the number of joints
+   *
+   * @note The maximum velocities of the joint limits and the maximum accelerations must be
+   * positive
+   *
+   * @note The joints are assumed to be at rest, and the goal time is kept above 0.2s so that
+   * set_all_positions() uses quintic polynomial interpolation
+   *
+   * @note The effort limits are not checked, pass accelerations_max derived from the payload to
+   * stay within JointLimit::effort_max
+   */
+  double get_minimum_goal_time(
+    const std::vector<double> & goal_positions,
+    double velocity_scaling = 1.0,
+    const std::vector<double> & accelerations_max = {}
+  );
+
   /**
    * @brief Set the positions of the arm joints
    *
@@ -895,6 +984,25 @@ public:
    */
   RobotOutput get_robot_output();
 
+  /**
+   * @brief Get the robot output into a reused structure
+   *
+   * @param robot_output Robot output
+   *
+   * @note The vectors in the structure do not reallocate once their capacities suffice
+   */
+  void get_robot_output(RobotOutput & robot_output);
+
+  /**
+   * @brief Get the robot output into a fixed-capacity structure
+   *
+   * @param robot_output Robot output
+   *
+   * @note Only the outputs of all joints are copied, the arm and gripper outputs are views into
+   * them
+   */
+  void get_robot_output(FixedRobotOutput & robot_output);
+
   /**
    * @brief Get the positions of all joints
    *
@@ -902,6 +1010,27 @@ public:
    */
   std::vector<double> get_all_positions();
 
+  /**
+   * @brief Get the positions of all joints into a reused vector
+   *
+   * @param positions Positions in rad for arm joints and m for the gripper joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_positions(std::vector<double> & positions);
+
+  /**
+   * @brief Get the positions of all joints into a caller-provided buffer
+   *
+   * @param positions Buffer to store the positions in rad for arm joints and m for the gripper
+   * joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_positions(double * positions, size_t size);
+
   /**
    * @brief Get the positions of the arm joints
    *
@@ -909,6 +1038,26 @@ public:
    */
   std::vector<double> get_arm_positions();
 
+  /**
+   * @brief Get the positions of the arm joints into a reused vector
+   *
+   * @param positions Positions in rad
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_positions(std::vector<double> & positions);
+
+  /**
+   * @brief Get the positions of the arm joints into a caller-provided buffer
+   *
+   * @param positions Buffer to store the positions in rad
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_positions(double * positions, size_t size);
+
   /**
    * @brief Get the position of the gripper
    *
@@ -941,6 +1090,27 @@ public:
    */
   std::vector<double> get_all_velocities();
 
+  /**
+   * @brief Get the velocities of all joints into a reused vector
+   *
+   * @param velocities Velocities in rad/s for arm joints and m/s for the gripper joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_velocities(std::vector<double> & velocities);
+
+  /**
+   * @brief Get the velocities of all joints into a caller-provided buffer
+   *
+   * @param velocities Buffer to store the velocities in rad/s for arm joints and m/s for the
+   * gripper joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_velocities(double * velocities, size_t size);
+
   /**
    * @brief Get the velocities of the arm joints
    *
@@ -948,6 +1118,26 @@ public:
    */
   std::vector<double> get_arm_velocities();
 
+  /**
+   * @brief Get the velocities of the arm joints into a reused vector
+   *
+   * @param velocities Velocities in rad/s
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_velocities(std::vector<double> & velocities);
+
+  /**
+   * @brief Get the velocities of the arm joints into a caller-provided buffer
+   *
+   * @param velocities Buffer to store the velocities in rad/s
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_velocities(double * velocities, size_t size);
+
   /**
    * @brief Get the velocity of the gripper
    *
@@ -982,12 +1172,53 @@ public:
   std::vector<double> get_all_accelerations();
 
   /**
-   * @brief Get the accelerations of all joints
+   * @brief Get the accelerations into a reused vector
    *
-   * @return Accelerations in rad/s^2 for arm joints and m/s^2 for the gripper joint
+   * @param accelerations Accelerations in rad/s^2 for arm joints and m/s^2 for the gripper joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_accelerations(std::vector<double> & accelerations);
+
+  /**
+   * @brief Get the accelerations into a caller-provided buffer
+   *
+   * @param accelerations Buffer to store the accelerations in rad/s^2 for arm joints and m/s^2 for
+   * the gripper joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_accelerations(double * accelerations, size_t size);
+
+  /**
+   * @brief Get the accelerations of the arm joints
+   *
+   * @return Accelerations in rad/s^2
    */
   std::vector<double> get_arm_accelerations();
 
+  /**
+   * @brief Get the accelerations of the arm joints into a reused vector
+   *
+   * @param accelerations Accelerations in rad/s^2
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_accelerations(std::vector<double> & accelerations);
+
+  /**
+   * @brief Get the accelerations of the arm joints into a caller-provided buffer
+   *
+   * @param accelerations Buffer to store the accelerations in rad/s^2
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_accelerations(double * accelerations, size_t size);
+
   /**
    * @brief Get the acceleration of the gripper
    *
@@ -1021,6 +1252,26 @@ public:
    */
   std::vector<double> get_all_efforts();
 
+  /**
+   * @brief Get the efforts of all joints into a reused vector
+   *
+   * @param efforts Efforts in Nm for arm joints and N for the gripper joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_efforts(std::vector<double> & efforts);
+
+  /**
+   * @brief Get the efforts of all joints into a caller-provided buffer
+   *
+   * @param efforts Buffer to store the efforts in Nm for arm joints and N for the gripper joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_efforts(double * efforts, size_t size);
+
   /**
    * @brief Get the efforts of the arm joints
    *
@@ -1028,6 +1279,26 @@ public:
    */
   std::vector<double> get_arm_efforts();
 
+  /**
+   * @brief Get the efforts of the arm joints into a reused vector
+   *
+   * @param efforts Efforts in Nm
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_efforts(std::vector<double> & efforts);
+
+  /**
+   * @brief Get the efforts of the arm joints into a caller-provided buffer
+   *
+   * @param efforts Buffer to store the efforts in Nm
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_efforts(double * efforts, size_t size);
+
   /**
    * @brief Get the effort of the gripper
    *
@@ -1050,6 +1321,27 @@ public:
    */
   std::vector<double> get_all_external_efforts();
 
+  /**
+   * @brief Get the external efforts of all joints into a reused vector
+   *
+   * @param external_efforts External efforts in Nm for arm joints and N for the gripper joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_external_efforts(std::vector<double> & external_efforts);
+
+  /**
+   * @brief Get the external efforts of all joints into a caller-provided buffer
+   *
+   * @param external_efforts Buffer to store the external efforts in Nm for arm joints and N for the
+   * gripper joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_external_efforts(double * external_efforts, size_t size);
+
   /**
    * @brief Get the external efforts of the arm joints
    *
@@ -1057,6 +1349,26 @@ public:
    */
   std::vector<double> get_arm_external_efforts();
 
+  /**
+   * @brief Get the external efforts of the arm joints into a reused vector
+   *
+   * @param external_efforts External efforts in Nm
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_external_efforts(std::vector<double> & external_efforts);
+
+  /**
+   * @brief Get the external efforts of the arm joints into a caller-provided buffer
+   *
+   * @param external_efforts Buffer to store the external efforts in Nm
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_external_efforts(double * external_efforts, size_t size);
+
   /**
    * @brief Get the external effort of the gripper
    *
@@ -1089,6 +1401,28 @@ public:
    */
   std::vector<double> get_all_compensation_efforts();
 
+  /**
+   * @brief Get the compensation efforts of all joints into a reused vector
+   *
+   * @param compensation_efforts Compensation efforts in Nm for arm joints and N for the gripper
+   * joint
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_compensation_efforts(std::vector<double> & compensation_efforts);
+
+  /**
+   * @brief Get the compensation efforts of all joints into a caller-provided buffer
+   *
+   * @param compensation_efforts Buffer to store the compensation efforts in Nm for arm joints and N
+   * for the gripper joint
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_compensation_efforts(double * compensation_efforts, size_t size);
+
   /**
    * @brief Get the compensation efforts of the arm joints
    *
@@ -1096,6 +1430,26 @@ public:
    */
   std::vector<double> get_arm_compensation_efforts();
 
+  /**
+   * @brief Get the compensation efforts of the arm joints into a reused vector
+   *
+   * @param compensation_efforts Compensation efforts in Nm
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_compensation_efforts(std::vector<double> & compensation_efforts);
+
+  /**
+   * @brief Get the compensation efforts of the arm joints into a caller-provided buffer
+   *
+   * @param compensation_efforts Buffer to store the compensation efforts in Nm
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_compensation_efforts(double * compensation_efforts, size_t size);
+
   /**
    * @brief Get the compensation effort of the gripper
    *
@@ -1118,6 +1472,26 @@ public:
    */
   std::vector<double> get_all_rotor_temperatures();
 
+  /**
+   * @brief Get the rotor temperatures of all joints into a reused vector
+   *
+   * @param rotor_temperatures Rotor temperatures in C
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_rotor_temperatures(std::vector<double> & rotor_temperatures);
+
+  /**
+   * @brief Get the rotor temperatures of all joints into a caller-provided buffer
+   *
+   * @param rotor_temperatures Buffer to store the rotor temperatures in C
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_rotor_temperatures(double * rotor_temperatures, size_t size);
+
   /**
    * @brief Get the rotor temperatures of the arm joints
    *
@@ -1125,6 +1499,26 @@ public:
    */
   std::vector<double> get_arm_rotor_temperatures();
 
+  /**
+   * @brief Get the rotor temperatures of the arm joints into a reused vector
+   *
+   * @param rotor_temperatures Rotor temperatures in C
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_rotor_temperatures(std::vector<double> & rotor_temperatures);
+
+  /**
+   * @brief Get the rotor temperatures of the arm joints into a caller-provided buffer
+   *
+   * @param rotor_temperatures Buffer to store the rotor temperatures in C
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_rotor_temperatures(double * rotor_temperatures, size_t size);
+
   /**
    * @brief Get the rotor temperature of the gripper
    *
@@ -1147,6 +1541,26 @@ public:
    */
   std::vector<double> get_all_driver_temperatures();
 
+  /**
+   * @brief Get the driver temperatures of all joints into a reused vector
+   *
+   * @param driver_temperatures Driver temperatures in C
+   *
+   * @note The vector is resized to the number of joints and does not reallocate once its capacity
+   * suffices
+   */
+  void get_all_driver_temperatures(std::vector<double> & driver_temperatures);
+
+  /**
+   * @brief Get the driver temperatures of all joints into a caller-provided buffer
+   *
+   * @param driver_temperatures Buffer to store the driver temperatures in C
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of joints
+   */
+  void get_all_driver_temperatures(double * driver_temperatures, size_t size);
+
   /**
    * @brief Get the driver temperatures of the arm joints
    *
@@ -1154,6 +1568,26 @@ public:
    */
   std::vector<double> get_arm_driver_temperatures();
 
+  /**
+   * @brief Get the driver temperatures of the arm joints into a reused vector
+   *
+   * @param driver_temperatures Driver temperatures in C
+   *
+   * @note The vector is resized to the number of arm joints and does not reallocate once its
+   * capacity suffices
+   */
+  void get_arm_driver_temperatures(std::vector<double> & driver_temperatures);
+
+  /**
+   * @brief Get the driver temperatures of the arm joints into a caller-provided buffer
+   *
+   * @param driver_temperatures Buffer to store the driver temperatures in C
+   * @param size Size of the buffer
+   *
+   * @note The size of the buffer should be equal to the number of arm joints
+   */
+  void get_arm_driver_temperatures(double * driver_temperatures, size_t size);
+
   /**
    * @brief Get the driver temperature of the gripper
    *
@@ -2015,6 +2449,25 @@ private:
    */
   ConfigurationVariant get_configuration(ConfigurationAddress configuration_address);
 
+  /**
+   * @brief Run a function on the robot output while holding the data mutex
+   *
+   * @param function Function taking a const reference to the robot output
+   *
+   * @note The mutexes are claimed following the multithreading design above
+   */
+  template<typename Function>
+  void read_robot_output(Function && function);
+
+  /**
+   * @brief Copy a vector into a caller-provided buffer
+   *
+   * @param source The vector to copy
+   * @param destination The buffer to copy into
+   * @param size Size of the buffer
+   */
+  static void copy_to_buffer(const std::vector<double> & source, double * destination, size_t size);
+
   /**
    * @brief Function to be executed by the daemon thread
    *
@@ -2035,6 +2488,491 @@ private:
   void daemon();
 };
 
+inline std::vector<std::string> TrossenArmDriver::configure(
+  Model model,
+  EndEffector end_effector,
+  const std::string serv_ip,
+  bool clear_error,
+  const DaemonOptions & daemon_options,
+  double timeout
+)
+{
+  configure(model, end_effector, serv_ip, clear_error, timeout);
+  return set_daemon_options(daemon_options);
+}
+
+inline std::vector<std::string> TrossenArmDriver::set_daemon_options(
+  const DaemonOptions & daemon_options
+)
+{
+  if (!daemon_thread_.joinable()) {
+    throw RuntimeError("Driver is not configured");
+  }
+  if (daemon_options.realtime_priority != 0) {
+    const int priority_min = sched_get_priority_min(SCHED_FIFO);
+    const int priority_max = sched_get_priority_max(SCHED_FIFO);
+    if (
+      daemon_options.realtime_priority < priority_min ||
+      daemon_options.realtime_priority > priority_max)
+    {
+      throw LogicError(
+        "Invalid real-time priority: " + std::to_string(daemon_options.realtime_priority) +
+        " is not within [" + std::to_string(priority_min) + ", " + std::to_string(priority_max) +
+        "]"
+      );
+    }
+  }
+#ifdef __linux__
+  for (int cpu : daemon_options.cpu_affinity) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      throw LogicError(
+        "Invalid CPU index: " + std::to_string(cpu) + " is not within [0, " +
+        std::to_string(CPU_SETSIZE - 1) + "]"
+      );
+    }
+  }
+#endif
+
+  // Apply every option and report the failures together without stopping the driver
+  std::vector<std::string> failures;
+  if (daemon_options.realtime_priority != 0) {
+    sched_param param{};
+    param.sched_priority = daemon_options.realtime_priority;
+    int error = pthread_setschedparam(daemon_thread_.native_handle(), SCHED_FIFO, &param);
+    if (error != 0) {
+      failures.push_back(
+        "failed to set the daemon thread to SCHED_FIFO with priority " +
+        std::to_string(daemon_options.realtime_priority) + " due to " + std::strerror(error)
+      );
+    }
+  }
+  if (!daemon_options.cpu_affinity.empty()) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : daemon_options.cpu_affinity) {
+      CPU_SET(cpu, &cpu_set);
+    }
+    int error = pthread_setaffinity_np(daemon_thread_.native_handle(), sizeof(cpu_set), &cpu_set);
+    if (error != 0) {
+      failures.push_back(
+        std::string("failed to set the daemon thread's CPU affinity due to ") +
+        std::strerror(error)
+      );
+    }
+#else
+    failures.push_back("setting the daemon thread's CPU affinity is only supported on Linux");
+#endif
+  }
+  if (daemon_options.lock_memory) {
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+      failures.push_back(
+        std::string("failed to lock the process memory due to ") + std::strerror(errno)
+      );
+    }
+  }
+  return failures;
+}
+
+inline double TrossenArmDriver::get_minimum_goal_time(
+  const std::vector<double> & goal_positions,
+  double velocity_scaling,
+  const std::vector<double> & accelerations_max
+)
+{
+  // Peak velocity and acceleration of a quintic rest-to-rest trajectory of unit distance and time
+  constexpr double PEAK_VELOCITY{15.0 / 8.0};
+  constexpr double PEAK_ACCELERATION{5.773502691896258};  // 10 / sqrt(3)
+  // Goal time above which set_all_positions() uses quintic polynomial interpolation
+  constexpr double QUINTIC_GOAL_TIME_MIN{0.2};
+
+  const size_t num_joints = get_num_joints();
+  if (goal_positions.size() != num_joints) {
+    throw LogicError(
+      "Invalid number of goal positions: " + std::to_string(goal_positions.size()) + " != " +
+      std::to_string(num_joints)
+    );
+  }
+  if (!accelerations_max.empty() && accelerations_max.size() != num_joints) {
+    throw LogicError(
+      "Invalid number of maximum accelerations: " + std::to_string(accelerations_max.size()) +
+      " != " + std::to_string(num_joints)
+    );
+  }
+  if (velocity_scaling <= 0.0 || velocity_scaling > 1.0) {
+    throw LogicError("Velocity scaling must be in (0.0, 1.0]");
+  }
+  const std::vector<double> positions = get_all_positions();
+  const std::vector<JointLimit> joint_limits = get_joint_limits();
+  double goal_time = std::nextafter(QUINTIC_GOAL_TIME_MIN, 1.0);
+  for (size_t i = 0; i < num_joints; ++i) {
+    if (!(joint_limits[i].velocity_max > 0.0)) {
+      throw LogicError("Joint " + std::to_string(i) + " maximum velocity must be positive");
+    }
+    if (!accelerations_max.empty() && !(accelerations_max[i] > 0.0)) {
+      throw LogicError("Joint " + std::to_string(i) + " maximum acceleration must be positive");
+    }
+    const double distance = std::abs(goal_positions[i] - positions[i]);
+    goal_time = std::max(
+      goal_time,
+      PEAK_VELOCITY * distance / (velocity_scaling * joint_limits[i].velocity_max)
+    );
+    if (!accelerations_max.empty()) {
+      goal_time = std::max(
+        goal_time,
+        std::sqrt(PEAK_ACCELERATION * distance / accelerations_max[i])
+      );
+    }
+  }
+  return goal_time;
+}
+
+inline void TrossenArmDriver::get_robot_output(RobotOutput & robot_output)
+{
+  read_robot_output(
+    [&robot_output](const RobotOutput & robot_output_source) {
+      robot_output = robot_output_source;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_robot_output(FixedRobotOutput & robot_output)
+{
+  read_robot_output(
+    [&robot_output](const RobotOutput & robot_output_source) {
+      robot_output.assign(robot_output_source);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_positions(std::vector<double> & positions)
+{
+  read_robot_output(
+    [&positions](const RobotOutput & robot_output) {
+      positions = robot_output.joint.all.positions;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_positions(double * positions, size_t size)
+{
+  read_robot_output(
+    [positions, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.positions, positions, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_velocities(std::vector<double> & velocities)
+{
+  read_robot_output(
+    [&velocities](const RobotOutput & robot_output) {
+      velocities = robot_output.joint.all.velocities;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_velocities(double * velocities, size_t size)
+{
+  read_robot_output(
+    [velocities, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.velocities, velocities, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_accelerations(std::vector<double> & accelerations)
+{
+  read_robot_output(
+    [&accelerations](const RobotOutput & robot_output) {
+      accelerations = robot_output.joint.all.accelerations;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_accelerations(double * accelerations, size_t size)
+{
+  read_robot_output(
+    [accelerations, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.accelerations, accelerations, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_efforts(std::vector<double> & efforts)
+{
+  read_robot_output(
+    [&efforts](const RobotOutput & robot_output) {
+      efforts = robot_output.joint.all.efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_efforts(double * efforts, size_t size)
+{
+  read_robot_output(
+    [efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.efforts, efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_external_efforts(std::vector<double> & external_efforts)
+{
+  read_robot_output(
+    [&external_efforts](const RobotOutput & robot_output) {
+      external_efforts = robot_output.joint.all.external_efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_external_efforts(double * external_efforts, size_t size)
+{
+  read_robot_output(
+    [external_efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.external_efforts, external_efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_compensation_efforts(
+  std::vector<double> & compensation_efforts
+)
+{
+  read_robot_output(
+    [&compensation_efforts](const RobotOutput & robot_output) {
+      compensation_efforts = robot_output.joint.all.compensation_efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_compensation_efforts(
+  double * compensation_efforts,
+  size_t size
+)
+{
+  read_robot_output(
+    [compensation_efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.compensation_efforts, compensation_efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_rotor_temperatures(std::vector<double> & rotor_temperatures)
+{
+  read_robot_output(
+    [&rotor_temperatures](const RobotOutput & robot_output) {
+      rotor_temperatures = robot_output.joint.all.rotor_temperatures;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_rotor_temperatures(double * rotor_temperatures, size_t size)
+{
+  read_robot_output(
+    [rotor_temperatures, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.rotor_temperatures, rotor_temperatures, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_driver_temperatures(std::vector<double> & driver_temperatures)
+{
+  read_robot_output(
+    [&driver_temperatures](const RobotOutput & robot_output) {
+      driver_temperatures = robot_output.joint.all.driver_temperatures;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_all_driver_temperatures(double * driver_temperatures, size_t size)
+{
+  read_robot_output(
+    [driver_temperatures, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.all.driver_temperatures, driver_temperatures, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_positions(std::vector<double> & positions)
+{
+  read_robot_output(
+    [&positions](const RobotOutput & robot_output) {
+      positions = robot_output.joint.arm.positions;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_positions(double * positions, size_t size)
+{
+  read_robot_output(
+    [positions, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.positions, positions, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_velocities(std::vector<double> & velocities)
+{
+  read_robot_output(
+    [&velocities](const RobotOutput & robot_output) {
+      velocities = robot_output.joint.arm.velocities;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_velocities(double * velocities, size_t size)
+{
+  read_robot_output(
+    [velocities, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.velocities, velocities, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_accelerations(std::vector<double> & accelerations)
+{
+  read_robot_output(
+    [&accelerations](const RobotOutput & robot_output) {
+      accelerations = robot_output.joint.arm.accelerations;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_accelerations(double * accelerations, size_t size)
+{
+  read_robot_output(
+    [accelerations, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.accelerations, accelerations, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_efforts(std::vector<double> & efforts)
+{
+  read_robot_output(
+    [&efforts](const RobotOutput & robot_output) {
+      efforts = robot_output.joint.arm.efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_efforts(double * efforts, size_t size)
+{
+  read_robot_output(
+    [efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.efforts, efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_external_efforts(std::vector<double> & external_efforts)
+{
+  read_robot_output(
+    [&external_efforts](const RobotOutput & robot_output) {
+      external_efforts = robot_output.joint.arm.external_efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_external_efforts(double * external_efforts, size_t size)
+{
+  read_robot_output(
+    [external_efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.external_efforts, external_efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_compensation_efforts(
+  std::vector<double> & compensation_efforts
+)
+{
+  read_robot_output(
+    [&compensation_efforts](const RobotOutput & robot_output) {
+      compensation_efforts = robot_output.joint.arm.compensation_efforts;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_compensation_efforts(
+  double * compensation_efforts,
+  size_t size
+)
+{
+  read_robot_output(
+    [compensation_efforts, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.compensation_efforts, compensation_efforts, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_rotor_temperatures(std::vector<double> & rotor_temperatures)
+{
+  read_robot_output(
+    [&rotor_temperatures](const RobotOutput & robot_output) {
+      rotor_temperatures = robot_output.joint.arm.rotor_temperatures;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_rotor_temperatures(double * rotor_temperatures, size_t size)
+{
+  read_robot_output(
+    [rotor_temperatures, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.rotor_temperatures, rotor_temperatures, size);
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_driver_temperatures(std::vector<double> & driver_temperatures)
+{
+  read_robot_output(
+    [&driver_temperatures](const RobotOutput & robot_output) {
+      driver_temperatures = robot_output.joint.arm.driver_temperatures;
+    }
+  );
+}
+
+inline void TrossenArmDriver::get_arm_driver_temperatures(double * driver_temperatures, size_t size)
+{
+  read_robot_output(
+    [driver_temperatures, size](const RobotOutput & robot_output) {
+      copy_to_buffer(robot_output.joint.arm.driver_temperatures, driver_temperatures, size);
+    }
+  );
+}
+
+template<typename Function>
+inline void TrossenArmDriver::read_robot_output(Function && function)
+{
+  std::unique_lock<std::mutex> lock_preempt(mutex_preempt_);
+  std::lock_guard<std::mutex> lock_data(mutex_data_);
+  lock_preempt.unlock();
+  if (exception_ptr_) {
+    std::rethrow_exception(exception_ptr_);
+  }
+  if (!configured_) {
+    throw RuntimeError("Driver is not configured");
+  }
+  function(robot_output_);
+}
+
+inline void TrossenArmDriver::copy_to_buffer(
+  const std::vector<double> & source,
+  double * destination,
+  size_t size
+)
+{
+  if (size != source.size()) {
+    throw LogicError(
+      "Buffer size " + std::to_string(size) + " does not match the expected size " +
+      std::to_string(source.size())
+    );
+  }
+  std::copy(source.begin(), source.end(), destination);
+}
+
 }  // namespace trossen_arm
 
 #endif  // LIBTROSSEN_ARM__TROSSEN_ARM_HPP_
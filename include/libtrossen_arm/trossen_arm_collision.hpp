@@ -0,0 +1,386 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_COLLISION_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_COLLISION_HPP_
+
+#include <cstddef>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_kinematics.hpp"
+#include "libtrossen_arm/trossen_arm_type.hpp"
+
+namespace trossen_arm
+{
+
+namespace detail
+{
+
+/**
+ * @brief Compute the distance between two segments
+ *
+ * @param p0 Start of the first segment
+ * @param p1 End of the first segment
+ * @param q0 Start of the second segment
+ * @param q1 End of the second segment
+ * @return Distance between the closest points of the segments, degenerate segments being points
+ */
+inline double compute_segment_distance(
+  const Vector3 & p0,
+  const Vector3 & p1,
+  const Vector3 & q0,
+  const Vector3 & q1
+)
+{
+  // Closest points of two segments, see Ericson, Real-Time Collision Detection, 5.1.9
+  constexpr double EPSILON{1e-12};
+  const Vector3 d1 = subtract(p1, p0);
+  const Vector3 d2 = subtract(q1, q0);
+  const Vector3 r = subtract(p0, q0);
+  const double a = dot(d1, d1);
+  const double e = dot(d2, d2);
+  const double f = dot(d2, r);
+  double s{0.0};
+  double t{0.0};
+  if (a <= EPSILON && e <= EPSILON) {
+    // Both segments are points
+  } else if (a <= EPSILON) {
+    t = std::clamp(f / e, 0.0, 1.0);
+  } else {
+    const double c = dot(d1, r);
+    if (e <= EPSILON) {
+      s = std::clamp(-c / a, 0.0, 1.0);
+    } else {
+      const double b = dot(d1, d2);
+      const double denominator = a * e - b * b;
+      s = denominator > EPSILON ? std::clamp((b * f - c * e) / denominator, 0.0, 1.0) : 0.0;
+      t = (b * s + f) / e;
+      if (t < 0.0) {
+        t = 0.0;
+        s = std::clamp(-c / a, 0.0, 1.0);
+      } else if (t > 1.0) {
+        t = 1.0;
+        s = std::clamp((b - c) / a, 0.0, 1.0);
+      }
+    }
+  }
+  const Vector3 difference = subtract(add(p0, scale(d1, s)), add(q0, scale(d2, t)));
+  return std::sqrt(dot(difference, difference));
+}
+
+}  // namespace detail
+
+/// @brief Configuration of the collision checker
+struct CollisionCheckerConfiguration
+{
+  /**
+   * @brief Radii of the capsules in m
+   *
+   * @details The capsules are, in order, the base from the base frame origin to joint 0, the
+   * segments between consecutive arm joints, and the end effector from joint 5 to the tool frame
+   */
+  std::array<double, 7> radii{0.04, 0.03, 0.025, 0.025, 0.025, 0.025, 0.035};
+  /// @brief Lower corner of the workspace box measured in the base frame in m
+  std::array<double, 3> workspace_min{
+    -std::numeric_limits<double>::infinity(),
+    -std::numeric_limits<double>::infinity(),
+    0.0
+  };
+  /// @brief Upper corner of the workspace box measured in the base frame in m
+  std::array<double, 3> workspace_max{
+    std::numeric_limits<double>::infinity(),
+    std::numeric_limits<double>::infinity(),
+    std::numeric_limits<double>::infinity()
+  };
+  /// @brief Minimum clearance in m to keep between capsules and to the workspace boundary
+  double margin{0.005};
+};
+
+/// @brief Result of a collision check
+struct CollisionResult
+{
+  /// @brief Whether two capsules of the arm are closer than the margin
+  bool self_collision{false};
+  /// @brief Whether a moving capsule is closer to the workspace boundary than the margin
+  bool workspace_violation{false};
+  /// @brief Smallest clearance in m among the checked capsule pairs and the workspace boundary
+  double clearance{std::numeric_limits<double>::infinity()};
+
+  /**
+   * @brief Get whether the configuration is collision-free
+   *
+   * @return true if neither a self-collision nor a workspace violation was found
+   */
+  bool is_safe() const
+  {
+    return !self_collision && !workspace_violation;
+  }
+};
+
+/**
+ * @brief Capsule-based self-collision and workspace checker of the arm
+ *
+ * @details The arm is covered by capsules along the segments between the joint frame origins,
+ * built from the Joint geometry. Every pair of capsules neither adjacent in the chain nor in
+ * EXCLUDED_PAIRS is checked by the closest points of their segments, and every moving capsule
+ * must stay inside the workspace box.
+ *
+ * A check costs one forward kinematics pass and 13 segment distances, about a microsecond, so
+ * it fits in every command cycle.
+ *
+ * @note The checker only guards the commands it is given, e.g. those of a TrajectoryStreamer;
+ * commands sent to the driver directly are not checked
+ */
+class CollisionChecker
+{
+public:
+  /// @brief Number of arm joints
+  static constexpr size_t NUM_ARM_JOINTS{ArmKinematics::NUM_ARM_JOINTS};
+
+  /// @brief Number of capsules
+  static constexpr size_t NUM_CAPSULES{NUM_ARM_JOINTS + 1};
+
+  /**
+   * @brief Pairs of non-adjacent capsules not checked for self-collision
+   *
+   * @details The base and the upper arm capsules are only separated by the short shoulder
+   * capsule from joint 0 to joint 1, and the first wrist and the end effector capsules by the
+   * short wrist capsule from joint 4 to joint 5. With the default radii, each of these pairs
+   * overlaps around the joints in between in every configuration, so checking them would always
+   * report a self-collision.
+   */
+  static constexpr std::array<std::array<size_t, 2>, 2> EXCLUDED_PAIRS{{{0, 2}, {4, 6}}};
+
+  /**
+   * @brief Construct the checker
+   *
+   * @param joints Joint kinematic properties, the first six being the arm joints
+   * @param end_effector End effector properties
+   * @param configuration Optional: capsule radii, workspace box, and margin
+   */
+  CollisionChecker(
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector,
+    const CollisionCheckerConfiguration & configuration = {}
+  );
+
+  /**
+   * @brief Check a configuration of the arm
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @return Result of the check
+   */
+  CollisionResult check(const ArmKinematics::JointPositions & joint_positions) const;
+
+  /**
+   * @brief Clamp a motion to its collision-free part
+   *
+   * @param start_positions Positions of the arm joints in rad the motion starts from
+   * @param goal_positions Positions of the arm joints in rad the motion goes to, moved back
+   * toward start_positions if in collision
+   * @param num_bisections Optional: number of bisections of the motion, default 10
+   * @return Fraction in [0.0, 1.0] of the motion kept
+   *
+   * @note The motion is assumed linear in joint space, with start_positions collision-free, and
+   * only the kept end is checked, so fast motions through thin obstacles are not detected
+   */
+  double clamp(
+    const ArmKinematics::JointPositions & start_positions,
+    ArmKinematics::JointPositions & goal_positions,
+    size_t num_bisections = 10
+  ) const;
+
+private:
+  // Unit rotation axes of the arm joints measured in their joint frames
+  std::array<detail::Vector3, NUM_ARM_JOINTS> axes_{};
+
+  // Translations of the joint frames measured in their parent frames in m
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins_{};
+
+  // Rotations of the joint frames relative to their parent frames
+  std::array<detail::Matrix3, NUM_ARM_JOINTS> rotations_{};
+
+  // Translation of the tool frame measured in the flange frame in m
+  detail::Vector3 tool_{};
+
+  // Configuration of the checker
+  CollisionCheckerConfiguration configuration_{};
+
+  // Capsule pairs checked for self-collision, the non-adjacent ones not in EXCLUDED_PAIRS
+  std::vector<std::array<size_t, 2>> pairs_{};
+
+  /**
+   * @brief Compute the endpoints of every capsule
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @return Start and end point of every capsule measured in the base frame
+   */
+  std::array<std::array<detail::Vector3, 2>, NUM_CAPSULES> compute_capsules(
+    const ArmKinematics::JointPositions & joint_positions
+  ) const;
+};
+
+inline CollisionChecker::CollisionChecker(
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector,
+  const CollisionCheckerConfiguration & configuration
+)
+: configuration_(configuration)
+{
+  if (joints.size() < NUM_ARM_JOINTS) {
+    throw LogicError(
+      "Invalid number of joints: " + std::to_string(joints.size()) + " < " +
+      std::to_string(NUM_ARM_JOINTS)
+    );
+  }
+  for (size_t i = 0; i < NUM_CAPSULES; ++i) {
+    if (configuration_.radii[i] < 0.0) {
+      throw LogicError("Capsule " + std::to_string(i) + " has a negative radius");
+    }
+  }
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    const Joint & joint = joints[i];
+    const detail::Vector3 axis{joint.axis[0], joint.axis[1], joint.axis[2]};
+    const double norm = std::sqrt(detail::dot(axis, axis));
+    if (norm < 1e-9 || joint.axis[3] != 0.0 || joint.axis[4] != 0.0 || joint.axis[5] != 0.0) {
+      throw LogicError("Arm joint " + std::to_string(i) + " is not a revolute joint");
+    }
+    axes_[i] = detail::scale(axis, 1.0 / norm);
+    origins_[i] = joint.origin_xyz;
+    rotations_[i] = detail::rotation_from_rpy(joint.origin_rpy);
+  }
+  tool_ = {
+    end_effector.t_flange_tool[0],
+    end_effector.t_flange_tool[1],
+    end_effector.t_flange_tool[2]
+  };
+
+  // Check the pairs of non-adjacent capsules that are not excluded
+  for (size_t i = 0; i < NUM_CAPSULES; ++i) {
+    for (size_t j = i + 2; j < NUM_CAPSULES; ++j) {
+      const std::array<size_t, 2> pair{i, j};
+      if (std::find(EXCLUDED_PAIRS.begin(), EXCLUDED_PAIRS.end(), pair) == EXCLUDED_PAIRS.end()) {
+        pairs_.push_back(pair);
+      }
+    }
+  }
+}
+
+inline CollisionResult CollisionChecker::check(
+  const ArmKinematics::JointPositions & joint_positions
+) const
+{
+  const auto capsules = compute_capsules(joint_positions);
+  CollisionResult result;
+  for (const auto & pair : pairs_) {
+    const double clearance = detail::compute_segment_distance(
+      capsules[pair[0]][0], capsules[pair[0]][1], capsules[pair[1]][0], capsules[pair[1]][1]
+    ) - configuration_.radii[pair[0]] - configuration_.radii[pair[1]];
+    result.clearance = std::min(result.clearance, clearance);
+  }
+  result.self_collision = result.clearance < configuration_.margin;
+
+  // The workspace box is convex, so a capsule is inside if both its end spheres are, and the
+  // base capsule is skipped since it does not move
+  double workspace_clearance = std::numeric_limits<double>::infinity();
+  for (size_t i = 1; i < NUM_CAPSULES; ++i) {
+    for (const detail::Vector3 & point : capsules[i]) {
+      for (size_t k = 0; k < 3; ++k) {
+        workspace_clearance = std::min(
+          {
+            workspace_clearance,
+            point[k] - configuration_.workspace_min[k] - configuration_.radii[i],
+            configuration_.workspace_max[k] - point[k] - configuration_.radii[i]
+          }
+        );
+      }
+    }
+  }
+  result.workspace_violation = workspace_clearance < configuration_.margin;
+  result.clearance = std::min(result.clearance, workspace_clearance);
+  return result;
+}
+
+inline double CollisionChecker::clamp(
+  const ArmKinematics::JointPositions & start_positions,
+  ArmKinematics::JointPositions & goal_positions,
+  size_t num_bisections
+) const
+{
+  if (check(goal_positions).is_safe()) {
+    return 1.0;
+  }
+  ArmKinematics::JointPositions direction;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    direction[i] = goal_positions[i] - start_positions[i];
+  }
+  double safe{0.0};
+  double unsafe{1.0};
+  ArmKinematics::JointPositions positions;
+  for (size_t n = 0; n < num_bisections; ++n) {
+    const double fraction = 0.5 * (safe + unsafe);
+    for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+      positions[i] = start_positions[i] + fraction * direction[i];
+    }
+    (check(positions).is_safe() ? safe : unsafe) = fraction;
+  }
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    goal_positions[i] = start_positions[i] + safe * direction[i];
+  }
+  return safe;
+}
+
+inline std::array<std::array<detail::Vector3, 2>, CollisionChecker::NUM_CAPSULES>
+CollisionChecker::compute_capsules(const ArmKinematics::JointPositions & joint_positions) const
+{
+  std::array<std::array<detail::Vector3, 2>, NUM_CAPSULES> capsules;
+  detail::Vector3 translation{};
+  detail::Matrix3 rotation = detail::IDENTITY3;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    capsules[i][0] = translation;
+    translation = detail::add(translation, detail::multiply(rotation, origins_[i]));
+    capsules[i][1] = translation;
+    rotation = detail::multiply(
+      detail::multiply(rotation, rotations_[i]),
+      detail::rotation_about_axis(axes_[i], joint_positions[i])
+    );
+  }
+  capsules[NUM_ARM_JOINTS][0] = translation;
+  capsules[NUM_ARM_JOINTS][1] = detail::add(translation, detail::multiply(rotation, tool_));
+  return capsules;
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_COLLISION_HPP_
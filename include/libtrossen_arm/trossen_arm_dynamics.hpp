@@ -0,0 +1,410 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_DYNAMICS_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_DYNAMICS_HPP_
+
+#include <cmath>
+#include <cstddef>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_kinematics.hpp"
+#include "libtrossen_arm/trossen_arm_type.hpp"
+
+namespace trossen_arm
+{
+
+/**
+ * @brief Rigid-body dynamics of the arm and the gripper fingers
+ *
+ * @details The joint efforts are computed with the recursive Newton-Euler algorithm, in O(n) with
+ * all quantities expressed in the link frames. Link frames coincide with the frames of the joints
+ * driving them. The bodies are the arm links 1-6 and both fingers, each finger being displaced
+ * along its prismatic axis by the gripper position and hanging from link 6.
+ *
+ * The link inertial properties are those of TrossenArmDriver::get_links() or StandardLinks, and
+ * the joint kinematic properties those of TrossenArmDriver::get_joints() or StandardJoints.
+ */
+class ArmDynamics
+{
+public:
+  /// @brief Number of arm joints
+  static constexpr size_t NUM_ARM_JOINTS{6};
+
+  /// @brief Number of joints, the arm joints and the gripper joint
+  static constexpr size_t NUM_JOINTS{NUM_ARM_JOINTS + 1};
+
+  /// @brief Positions, velocities, accelerations, or efforts of all joints
+  using JointVector = std::array<double, NUM_JOINTS>;
+
+  /**
+   * @brief Construct the dynamics
+   *
+   * @param joints Joint kinematic properties of the arm joints, finger_left, and finger_right
+   * @param links Link inertial properties of the base link, the arm links 1-6, finger_left, and
+   * finger_right
+   * @param gravity Optional: gravitational acceleration in m/s^2 measured in the base frame,
+   * default {0.0, 0.0, -9.81}
+   */
+  ArmDynamics(
+    const std::vector<Joint> & joints,
+    const std::vector<Link> & links,
+    const std::array<double, 3> & gravity = {0.0, 0.0, -9.81}
+  );
+
+  /**
+   * @brief Compute the efforts producing given accelerations
+   *
+   * @param positions Positions in rad for arm joints and m for the gripper joint
+   * @param velocities Velocities in rad/s for arm joints and m/s for the gripper joint
+   * @param accelerations Accelerations in rad/s^2 for arm joints and m/s^2 for the gripper joint
+   * @return Efforts in Nm for arm joints and N for the gripper joint, gravity included
+   */
+  JointVector compute_inverse_dynamics(
+    const JointVector & positions,
+    const JointVector & velocities,
+    const JointVector & accelerations
+  ) const;
+
+  /**
+   * @brief Compute the efforts producing given accelerations for every sample of a trajectory
+   *
+   * @param positions Positions of every sample
+   * @param velocities Velocities of every sample
+   * @param accelerations Accelerations of every sample
+   * @return Efforts of every sample, gravity included
+   */
+  std::vector<JointVector> compute_inverse_dynamics(
+    const std::vector<JointVector> & positions,
+    const std::vector<JointVector> & velocities,
+    const std::vector<JointVector> & accelerations
+  ) const;
+
+  /**
+   * @brief Compute the efforts producing given accelerations, gravity excluded
+   *
+   * @param positions Positions in rad for arm joints and m for the gripper joint
+   * @param velocities Velocities in rad/s for arm joints and m/s for the gripper joint
+   * @param accelerations Accelerations in rad/s^2 for arm joints and m/s^2 for the gripper joint
+   * @return Inertial, centrifugal, and Coriolis efforts in Nm for arm joints and N for the gripper
+   * joint
+   *
+   * @note These are the efforts to add to the arm controller's compensation efforts
+   */
+  JointVector compute_inertial_efforts(
+    const JointVector & positions,
+    const JointVector & velocities,
+    const JointVector & accelerations
+  ) const;
+
+  /**
+   * @brief Compute the efforts holding the arm still against gravity
+   *
+   * @param positions Positions in rad for arm joints and m for the gripper joint
+   * @return Efforts in Nm for arm joints and N for the gripper joint
+   */
+  JointVector compute_gravity_efforts(const JointVector & positions) const;
+
+private:
+  // Number of bodies, the arm links 1-6 and both fingers
+  static constexpr size_t NUM_BODIES{NUM_ARM_JOINTS + 2};
+
+  // Index of the body the fingers hang from
+  static constexpr size_t FINGER_PARENT{NUM_ARM_JOINTS - 1};
+
+  // Kinematic and inertial properties of a body
+  struct Body
+  {
+    // Whether the joint driving the body is revolute, else prismatic
+    bool revolute{true};
+    // Unit joint axis measured in the joint frame
+    detail::Vector3 axis{};
+    // Translation of the joint frame measured in the parent frame in m
+    detail::Vector3 origin{};
+    // Rotation of the joint frame relative to the parent frame
+    detail::Matrix3 rotation{detail::IDENTITY3};
+    // Mass in kg
+    double mass{0.0};
+    // Center of mass measured in the body frame in m
+    detail::Vector3 center{};
+    // Inertia about the center of mass measured in the body frame in kg m^2
+    detail::Matrix3 inertia{};
+  };
+
+  // Properties of every body, parents before children
+  std::array<Body, NUM_BODIES> bodies_{};
+
+  // Gravitational acceleration measured in the base frame in m/s^2
+  detail::Vector3 gravity_{};
+
+  /**
+   * @brief Run the recursive Newton-Euler algorithm
+   *
+   * @param positions Positions of all joints
+   * @param velocities Velocities of all joints
+   * @param accelerations Accelerations of all joints
+   * @param gravity Gravitational acceleration measured in the base frame
+   * @return Efforts of all joints
+   */
+  JointVector compute(
+    const JointVector & positions,
+    const JointVector & velocities,
+    const JointVector & accelerations,
+    const detail::Vector3 & gravity
+  ) const;
+};
+
+inline ArmDynamics::ArmDynamics(
+  const std::vector<Joint> & joints,
+  const std::vector<Link> & links,
+  const std::array<double, 3> & gravity
+)
+: gravity_(gravity)
+{
+  if (joints.size() != NUM_BODIES) {
+    throw LogicError(
+      "Invalid number of joints: " + std::to_string(joints.size()) + " != " +
+      std::to_string(NUM_BODIES)
+    );
+  }
+  if (links.size() != NUM_BODIES + 1) {
+    throw LogicError(
+      "Invalid number of links: " + std::to_string(links.size()) + " != " +
+      std::to_string(NUM_BODIES + 1)
+    );
+  }
+  for (size_t i = 0; i < NUM_BODIES; ++i) {
+    const Joint & joint = joints[i];
+    // Skip the base link, which does not move
+    const Link & link = links[i + 1];
+    Body & body = bodies_[i];
+    body.revolute = i < NUM_ARM_JOINTS;
+    const size_t offset = body.revolute ? 0 : 3;
+    const detail::Vector3 axis{
+      joint.axis[offset], joint.axis[offset + 1], joint.axis[offset + 2]
+    };
+    const detail::Vector3 other{
+      joint.axis[3 - offset], joint.axis[4 - offset], joint.axis[5 - offset]
+    };
+    const double norm = std::sqrt(detail::dot(axis, axis));
+    if (norm < 1e-9 || detail::dot(other, other) != 0.0) {
+      throw LogicError(
+        "Joint " + std::to_string(i) + " is not a " +
+        (body.revolute ? "revolute" : "prismatic") + " joint"
+      );
+    }
+    body.axis = detail::scale(axis, 1.0 / norm);
+    body.origin = joint.origin_xyz;
+    body.rotation = detail::rotation_from_rpy(joint.origin_rpy);
+    body.mass = link.mass;
+    body.center = link.origin_xyz;
+    // Rotate the inertia from the inertia frame to the body frame
+    const detail::Matrix3 inertia_rotation = detail::rotation_from_rpy(link.origin_rpy);
+    body.inertia = detail::multiply(
+      detail::multiply(inertia_rotation, link.inertia),
+      detail::transpose(inertia_rotation)
+    );
+  }
+}
+
+inline ArmDynamics::JointVector ArmDynamics::compute_inverse_dynamics(
+  const JointVector & positions,
+  const JointVector & velocities,
+  const JointVector & accelerations
+) const
+{
+  return compute(positions, velocities, accelerations, gravity_);
+}
+
+inline std::vector<ArmDynamics::JointVector> ArmDynamics::compute_inverse_dynamics(
+  const std::vector<JointVector> & positions,
+  const std::vector<JointVector> & velocities,
+  const std::vector<JointVector> & accelerations
+) const
+{
+  if (velocities.size() != positions.size() || accelerations.size() != positions.size()) {
+    throw LogicError(
+      "Invalid number of samples: " + std::to_string(positions.size()) + " positions, " +
+      std::to_string(velocities.size()) + " velocities, " +
+      std::to_string(accelerations.size()) + " accelerations"
+    );
+  }
+  std::vector<JointVector> efforts(positions.size());
+  for (size_t i = 0; i < positions.size(); ++i) {
+    efforts[i] = compute(positions[i], velocities[i], accelerations[i], gravity_);
+  }
+  return efforts;
+}
+
+inline ArmDynamics::JointVector ArmDynamics::compute_inertial_efforts(
+  const JointVector & positions,
+  const JointVector & velocities,
+  const JointVector & accelerations
+) const
+{
+  return compute(positions, velocities, accelerations, {});
+}
+
+inline ArmDynamics::JointVector ArmDynamics::compute_gravity_efforts(
+  const JointVector & positions
+) const
+{
+  return compute(positions, {}, {}, gravity_);
+}
+
+inline ArmDynamics::JointVector ArmDynamics::compute(
+  const JointVector & positions,
+  const JointVector & velocities,
+  const JointVector & accelerations,
+  const detail::Vector3 & gravity
+) const
+{
+  // Rotation from every body frame to its parent frame and body origin in the parent frame
+  std::array<detail::Matrix3, NUM_BODIES> rotations;
+  std::array<detail::Vector3, NUM_BODIES> translations;
+  // Angular velocity, angular acceleration, and linear acceleration of the body origin, measured
+  // in the body frame
+  std::array<detail::Vector3, NUM_BODIES> omegas;
+  std::array<detail::Vector3, NUM_BODIES> alphas;
+  std::array<detail::Vector3, NUM_BODIES> linears;
+  // Force and moment about the body origin exerted by the parent, measured in the body frame
+  std::array<detail::Vector3, NUM_BODIES> forces;
+  std::array<detail::Vector3, NUM_BODIES> moments;
+
+  // Forward pass: propagate the motion from the base, which accelerates upward to model gravity
+  for (size_t i = 0; i < NUM_BODIES; ++i) {
+    const Body & body = bodies_[i];
+    // Both fingers are driven by the gripper joint
+    const size_t joint = std::min(i, NUM_ARM_JOINTS);
+    const double q = positions[joint];
+    const double qd = velocities[joint];
+    const double qdd = accelerations[joint];
+
+    detail::Vector3 omega_parent{};
+    detail::Vector3 alpha_parent{};
+    detail::Vector3 linear_parent = detail::scale(gravity, -1.0);
+    if (i > 0) {
+      const size_t parent = body.revolute ? i - 1 : FINGER_PARENT;
+      omega_parent = omegas[parent];
+      alpha_parent = alphas[parent];
+      linear_parent = linears[parent];
+    }
+
+    if (body.revolute) {
+      rotations[i] = detail::multiply(body.rotation, detail::rotation_about_axis(body.axis, q));
+      translations[i] = body.origin;
+    } else {
+      rotations[i] = body.rotation;
+      translations[i] = detail::add(
+        body.origin,
+        detail::multiply(body.rotation, detail::scale(body.axis, q))
+      );
+    }
+    const detail::Matrix3 rotation_inverse = detail::transpose(rotations[i]);
+
+    // Linear acceleration of the body origin as a point of the parent
+    const detail::Vector3 linear = detail::multiply(
+      rotation_inverse,
+      detail::add(
+        linear_parent,
+        detail::add(
+          detail::cross(alpha_parent, translations[i]),
+          detail::cross(omega_parent, detail::cross(omega_parent, translations[i]))
+        )
+      )
+    );
+    const detail::Vector3 omega = detail::multiply(rotation_inverse, omega_parent);
+    const detail::Vector3 alpha = detail::multiply(rotation_inverse, alpha_parent);
+    if (body.revolute) {
+      const detail::Vector3 joint_omega = detail::scale(body.axis, qd);
+      omegas[i] = detail::add(omega, joint_omega);
+      alphas[i] = detail::add(
+        alpha,
+        detail::add(detail::scale(body.axis, qdd), detail::cross(omega, joint_omega))
+      );
+      linears[i] = linear;
+    } else {
+      const detail::Vector3 joint_velocity = detail::scale(body.axis, qd);
+      omegas[i] = omega;
+      alphas[i] = alpha;
+      linears[i] = detail::add(
+        linear,
+        detail::add(
+          detail::scale(body.axis, qdd),
+          detail::scale(detail::cross(omega, joint_velocity), 2.0)
+        )
+      );
+    }
+
+    // Net force and moment about the center of mass by the Newton-Euler equations
+    const detail::Vector3 center_acceleration = detail::add(
+      linears[i],
+      detail::add(
+        detail::cross(alphas[i], body.center),
+        detail::cross(omegas[i], detail::cross(omegas[i], body.center))
+      )
+    );
+    forces[i] = detail::scale(center_acceleration, body.mass);
+    moments[i] = detail::add(
+      detail::multiply(body.inertia, alphas[i]),
+      detail::cross(omegas[i], detail::multiply(body.inertia, omegas[i]))
+    );
+    // Move the moment to the body origin
+    moments[i] = detail::add(moments[i], detail::cross(body.center, forces[i]));
+  }
+
+  // Backward pass: accumulate the wrenches of the children and project them on the joint axes
+  JointVector efforts{};
+  for (size_t k = NUM_BODIES; k-- > 0;) {
+    const Body & body = bodies_[k];
+    const size_t joint = std::min(k, NUM_ARM_JOINTS);
+    efforts[joint] += detail::dot(body.axis, body.revolute ? moments[k] : forces[k]);
+    if (k == 0) {
+      break;
+    }
+    const size_t parent = body.revolute ? k - 1 : FINGER_PARENT;
+    const detail::Vector3 force = detail::multiply(rotations[k], forces[k]);
+    forces[parent] = detail::add(forces[parent], force);
+    moments[parent] = detail::add(
+      moments[parent],
+      detail::add(
+        detail::multiply(rotations[k], moments[k]),
+        detail::cross(translations[k], force)
+      )
+    );
+  }
+  return efforts;
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_DYNAMICS_HPP_
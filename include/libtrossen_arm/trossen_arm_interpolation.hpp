@@ -0,0 +1,557 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_INTERPOLATION_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_INTERPOLATION_HPP_
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#include <cstddef>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_type.hpp"
+
+namespace trossen_arm
+{
+
+/**
+ * @brief Quintic Hermite interpolator of multiple channels sharing one duration
+ *
+ * @details The coefficients of all channels, e.g. all joints or all twist axes, are stored in
+ * structure-of-arrays form, so one evaluation computes the position, velocity, and acceleration of
+ * every channel at once. On x86-64 CPUs supporting AVX, detected at run time so that the
+ * evaluation does not depend on the compiler flags of the including translation unit, the
+ * channels are evaluated four at a time, on AArch64 two at a time with NEON, and one at a time
+ * otherwise. Unused channels are padded with zeros.
+ */
+class BatchQuinticHermiteInterpolator
+{
+public:
+  /// @brief Maximum number of channels
+  static constexpr size_t MAX_NUM_CHANNELS{8};
+
+  /// @brief Values of all channels
+  using Channels = std::array<double, MAX_NUM_CHANNELS>;
+
+  /**
+   * @brief Compute the coefficients of all channels
+   *
+   * @param num_channels Number of channels
+   * @param start_positions Positions of every channel at time 0
+   * @param start_velocities Velocities of every channel at time 0
+   * @param start_accelerations Accelerations of every channel at time 0
+   * @param end_positions Positions of every channel at the duration
+   * @param end_velocities Velocities of every channel at the duration
+   * @param end_accelerations Accelerations of every channel at the duration
+   * @param duration Duration in s, non-positive for a step to the end values
+   */
+  void compute_coefficients(
+    size_t num_channels,
+    const double * start_positions,
+    const double * start_velocities,
+    const double * start_accelerations,
+    const double * end_positions,
+    const double * end_velocities,
+    const double * end_accelerations,
+    double duration
+  );
+
+  /**
+   * @brief Evaluate all channels
+   *
+   * @param time Time in s since the start, clamped to [0, duration]
+   * @param positions Positions of every channel
+   * @param velocities Velocities of every channel
+   * @param accelerations Accelerations of every channel
+   *
+   * @note Channels beyond the number of channels are set to zero
+   */
+  void evaluate(
+    double time,
+    Channels & positions,
+    Channels & velocities,
+    Channels & accelerations
+  ) const;
+
+  /**
+   * @brief Get the number of channels
+   *
+   * @return Number of channels
+   */
+  size_t get_num_channels() const;
+
+  /**
+   * @brief Get the duration
+   *
+   * @return Duration in s
+   */
+  double get_duration() const;
+
+private:
+  // Number of channels
+  size_t num_channels_{0};
+
+  // Duration in s
+  double duration_{0.0};
+
+  // Position coefficients of every channel by increasing power of time
+  alignas(32) std::array<Channels, 6> position_coefficients_{};
+
+  // Velocity coefficients of every channel by increasing power of time
+  alignas(32) std::array<Channels, 5> velocity_coefficients_{};
+
+  // Acceleration coefficients of every channel by increasing power of time
+  alignas(32) std::array<Channels, 4> acceleration_coefficients_{};
+
+  /**
+   * @brief Evaluate a polynomial of every channel one channel at a time
+   *
+   * @param coefficients Coefficients of every channel by increasing power of time
+   * @param time Time in s
+   * @param values Values of every channel
+   */
+  template<size_t N>
+  static void evaluate_polynomial(
+    const std::array<Channels, N> & coefficients,
+    double time,
+    Channels & values
+  );
+
+#if defined(__x86_64__) && defined(__GNUC__)
+  /**
+   * @brief Evaluate a polynomial of every channel four channels at a time with AVX
+   *
+   * @param coefficients Coefficients of every channel by increasing power of time
+   * @param time Time in s
+   * @param values Values of every channel
+   *
+   * @note The CPU must support AVX, see has_avx()
+   */
+  template<size_t N>
+  __attribute__((target("avx"))) static void evaluate_polynomial_avx(
+    const std::array<Channels, N> & coefficients,
+    double time,
+    Channels & values
+  );
+
+  /**
+   * @brief Get whether the CPU supports AVX
+   *
+   * @return true if AVX is supported, detected once
+   */
+  static bool has_avx();
+#elif defined(__aarch64__)
+  /**
+   * @brief Evaluate a polynomial of every channel two channels at a time with NEON
+   *
+   * @param coefficients Coefficients of every channel by increasing power of time
+   * @param time Time in s
+   * @param values Values of every channel
+   */
+  template<size_t N>
+  static void evaluate_polynomial_neon(
+    const std::array<Channels, N> & coefficients,
+    double time,
+    Channels & values
+  );
+#endif
+};
+
+inline void BatchQuinticHermiteInterpolator::compute_coefficients(
+  size_t num_channels,
+  const double * start_positions,
+  const double * start_velocities,
+  const double * start_accelerations,
+  const double * end_positions,
+  const double * end_velocities,
+  const double * end_accelerations,
+  double duration
+)
+{
+  if (num_channels > MAX_NUM_CHANNELS) {
+    throw LogicError(
+      "Number of channels exceeds the maximum: " + std::to_string(num_channels) + " > " +
+      std::to_string(MAX_NUM_CHANNELS)
+    );
+  }
+  num_channels_ = num_channels;
+  duration_ = std::max(duration, 0.0);
+  for (auto & coefficients : position_coefficients_) {
+    coefficients.fill(0.0);
+  }
+  for (size_t i = 0; i < num_channels; ++i) {
+    auto & c = position_coefficients_;
+    if (duration_ == 0.0) {
+      c[0][i] = end_positions[i];
+      c[1][i] = end_velocities[i];
+      c[2][i] = 0.5 * end_accelerations[i];
+      continue;
+    }
+    const double t = duration_;
+    const double h = end_positions[i] - start_positions[i];
+    const double v0 = start_velocities[i];
+    const double v1 = end_velocities[i];
+    const double a0 = start_accelerations[i];
+    const double a1 = end_accelerations[i];
+    c[0][i] = start_positions[i];
+    c[1][i] = v0;
+    c[2][i] = 0.5 * a0;
+    c[3][i] = (20.0 * h - (8.0 * v1 + 12.0 * v0) * t - (3.0 * a0 - a1) * t * t) /
+      (2.0 * t * t * t);
+    c[4][i] = (-30.0 * h + (14.0 * v1 + 16.0 * v0) * t + (3.0 * a0 - 2.0 * a1) * t * t) /
+      (2.0 * t * t * t * t);
+    c[5][i] = (12.0 * h - 6.0 * (v1 + v0) * t - (a0 - a1) * t * t) /
+      (2.0 * t * t * t * t * t);
+  }
+  for (size_t k = 0; k < velocity_coefficients_.size(); ++k) {
+    for (size_t i = 0; i < MAX_NUM_CHANNELS; ++i) {
+      velocity_coefficients_[k][i] = (k + 1) * position_coefficients_[k + 1][i];
+    }
+  }
+  for (size_t k = 0; k < acceleration_coefficients_.size(); ++k) {
+    for (size_t i = 0; i < MAX_NUM_CHANNELS; ++i) {
+      acceleration_coefficients_[k][i] = (k + 1) * velocity_coefficients_[k + 1][i];
+    }
+  }
+}
+
+inline void BatchQuinticHermiteInterpolator::evaluate(
+  double time,
+  Channels & positions,
+  Channels & velocities,
+  Channels & accelerations
+) const
+{
+  const double t = std::clamp(time, 0.0, duration_);
+#if defined(__x86_64__) && defined(__GNUC__)
+  if (has_avx()) {
+    evaluate_polynomial_avx(position_coefficients_, t, positions);
+    evaluate_polynomial_avx(velocity_coefficients_, t, velocities);
+    evaluate_polynomial_avx(acceleration_coefficients_, t, accelerations);
+    return;
+  }
+#elif defined(__aarch64__)
+  evaluate_polynomial_neon(position_coefficients_, t, positions);
+  evaluate_polynomial_neon(velocity_coefficients_, t, velocities);
+  evaluate_polynomial_neon(acceleration_coefficients_, t, accelerations);
+  return;
+#endif
+  evaluate_polynomial(position_coefficients_, t, positions);
+  evaluate_polynomial(velocity_coefficients_, t, velocities);
+  evaluate_polynomial(acceleration_coefficients_, t, accelerations);
+}
+
+template<size_t N>
+void BatchQuinticHermiteInterpolator::evaluate_polynomial(
+  const std::array<Channels, N> & coefficients,
+  double time,
+  Channels & values
+)
+{
+  // Horner's scheme from the highest power down
+  for (size_t i = 0; i < MAX_NUM_CHANNELS; ++i) {
+    double result = coefficients[N - 1][i];
+    for (size_t k = N - 1; k-- > 0; ) {
+      result = result * time + coefficients[k][i];
+    }
+    values[i] = result;
+  }
+}
+
+#if defined(__x86_64__) && defined(__GNUC__)
+template<size_t N>
+__attribute__((target("avx"))) void BatchQuinticHermiteInterpolator::evaluate_polynomial_avx(
+  const std::array<Channels, N> & coefficients,
+  double time,
+  Channels & values
+)
+{
+  constexpr size_t WIDTH{4};
+  const __m256d tt = _mm256_set1_pd(time);
+  // Horner's scheme from the highest power down
+  for (size_t i = 0; i < MAX_NUM_CHANNELS; i += WIDTH) {
+    __m256d result = _mm256_load_pd(&coefficients[N - 1][i]);
+    for (size_t k = N - 1; k-- > 0; ) {
+      result = _mm256_add_pd(_mm256_mul_pd(result, tt), _mm256_load_pd(&coefficients[k][i]));
+    }
+    _mm256_storeu_pd(&values[i], result);
+  }
+}
+
+inline bool BatchQuinticHermiteInterpolator::has_avx()
+{
+  static const bool has_avx = []() {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx") != 0;
+    }();
+  return has_avx;
+}
+#elif defined(__aarch64__)
+template<size_t N>
+void BatchQuinticHermiteInterpolator::evaluate_polynomial_neon(
+  const std::array<Channels, N> & coefficients,
+  double time,
+  Channels & values
+)
+{
+  constexpr size_t WIDTH{2};
+  const float64x2_t tt = vdupq_n_f64(time);
+  // Horner's scheme from the highest power down
+  for (size_t i = 0; i < MAX_NUM_CHANNELS; i += WIDTH) {
+    float64x2_t result = vld1q_f64(&coefficients[N - 1][i]);
+    for (size_t k = N - 1; k-- > 0; ) {
+      result = vfmaq_f64(vld1q_f64(&coefficients[k][i]), result, tt);
+    }
+    vst1q_f64(&values[i], result);
+  }
+}
+#endif
+
+inline size_t BatchQuinticHermiteInterpolator::get_num_channels() const
+{
+  return num_channels_;
+}
+
+inline double BatchQuinticHermiteInterpolator::get_duration() const
+{
+  return duration_;
+}
+
+/**
+ * @brief C2-continuous cubic spline through joint waypoints
+ *
+ * @details One cubic polynomial per joint and segment is fitted once at construction, starting and
+ * ending at rest with zero velocities and accelerations, so the positions, velocities, and
+ * accelerations are continuous through every via point and at both ends. The two extra
+ * acceleration constraints are met by an extra knot in the middle of the first and last segments,
+ * or at a third and two thirds of a single segment, whose positions are fitted along with the
+ * spline. The coefficients of all segments are stored contiguously, segment by segment,
+ * and evaluations at non-decreasing times find their segment in constant time by advancing a
+ * cursor from the previous one.
+ */
+class CubicSplinePath
+{
+public:
+  /**
+   * @brief Fit the spline
+   *
+   * @param waypoints Positions of all joints at every waypoint, the first one at time 0
+   * @param times Times in s of every waypoint, strictly increasing from 0.0
+   */
+  CubicSplinePath(
+    const std::vector<std::vector<double>> & waypoints,
+    const std::vector<double> & times
+  );
+
+  /**
+   * @brief Evaluate all joints
+   *
+   * @param time Time in s, clamped to [0, duration]
+   * @param positions Positions of every joint
+   * @param velocities Velocities of every joint
+   * @param accelerations Accelerations of every joint
+   *
+   * @note The output vectors must have the size of the number of joints
+   */
+  void evaluate(
+    double time,
+    std::vector<double> & positions,
+    std::vector<double> & velocities,
+    std::vector<double> & accelerations
+  );
+
+  /**
+   * @brief Get the number of joints
+   *
+   * @return Number of joints
+   */
+  size_t get_num_joints() const;
+
+  /**
+   * @brief Get the duration
+   *
+   * @return Time in s of the last waypoint
+   */
+  double get_duration() const;
+
+private:
+  // Number of coefficients per joint and segment
+  static constexpr size_t NUM_COEFFICIENTS{4};
+
+  // Number of joints
+  size_t num_joints_{0};
+
+  // Times of every waypoint
+  std::vector<double> times_{};
+
+  // Coefficients indexed by segment, power of the local time, then joint
+  std::vector<double> coefficients_{};
+
+  // Index of the segment of the latest evaluation
+  size_t cursor_{0};
+};
+
+inline CubicSplinePath::CubicSplinePath(
+  const std::vector<std::vector<double>> & waypoints,
+  const std::vector<double> & times
+)
+{
+  if (waypoints.size() < 2 || waypoints.size() != times.size()) {
+    throw LogicError(
+      "A path needs at least two waypoints with one time each: " +
+      std::to_string(waypoints.size()) + " waypoints, " + std::to_string(times.size()) +
+      " times"
+    );
+  }
+  if (times.front() != 0.0) {
+    throw LogicError("The first waypoint time must be 0.0");
+  }
+  for (size_t i = 1; i < times.size(); ++i) {
+    if (!(times[i] > times[i - 1])) {
+      throw LogicError("Waypoint times must be strictly increasing");
+    }
+  }
+  num_joints_ = waypoints.front().size();
+  for (const auto & waypoint : waypoints) {
+    if (waypoint.size() != num_joints_) {
+      throw LogicError("All waypoints must have the same number of joints");
+    }
+  }
+
+  // Knots of the waypoints with an extra knot after the first one and before the last one
+  const size_t num_points = waypoints.size();
+  const size_t num_knots = num_points + 2;
+  const size_t num_segments = num_knots - 1;
+  times_.reserve(num_knots);
+  times_.push_back(times.front());
+  if (num_points == 2) {
+    times_.push_back((2.0 * times[0] + times[1]) / 3.0);
+    times_.push_back((times[0] + 2.0 * times[1]) / 3.0);
+  } else {
+    times_.push_back(0.5 * (times[0] + times[1]));
+    times_.insert(times_.end(), times.begin() + 1, times.end() - 1);
+    times_.push_back(0.5 * (times[num_points - 2] + times[num_points - 1]));
+  }
+  times_.push_back(times.back());
+  coefficients_.resize(num_segments * NUM_COEFFICIENTS * num_joints_);
+
+  auto h = [this](size_t i) {return times_[i + 1] - times_[i];};
+  // Zero end velocities and accelerations set the positions of the extra knots to those of the
+  // end waypoints plus these gains times their second derivatives, and zero elsewhere
+  std::vector<double> gains(num_knots, 0.0);
+  gains[1] = h(0) * h(0) / 6.0;
+  gains[num_knots - 2] = h(num_segments - 1) * h(num_segments - 1) / 6.0;
+  // Tridiagonal system of the second derivatives at the inner knots, solved per joint with the
+  // Thomas algorithm, the second derivatives at the end knots being zero
+  std::vector<double> diagonal(num_knots);
+  std::vector<double> upper(num_knots);
+  std::vector<double> rhs(num_knots);
+  std::vector<double> second_derivatives(num_knots, 0.0);
+  std::vector<double> y(num_knots);
+  for (size_t j = 0; j < num_joints_; ++j) {
+    for (size_t k = 0; k < num_knots; ++k) {
+      y[k] = waypoints[std::min(std::max(k, size_t{1}) - 1, num_points - 1)][j];
+    }
+    auto slope = [&y, &h](size_t i) {return (y[i + 1] - y[i]) / h(i);};
+    for (size_t i = 1; i < num_segments; ++i) {
+      const double lower = h(i - 1) - 6.0 * gains[i - 1] / h(i - 1);
+      diagonal[i] = 2.0 * (h(i - 1) + h(i)) + 6.0 * gains[i] * (1.0 / h(i - 1) + 1.0 / h(i));
+      upper[i] = h(i) - 6.0 * gains[i + 1] / h(i);
+      rhs[i] = 6.0 * (slope(i) - slope(i - 1));
+      if (i > 1) {
+        const double factor = lower / diagonal[i - 1];
+        diagonal[i] -= factor * upper[i - 1];
+        rhs[i] -= factor * rhs[i - 1];
+      }
+    }
+    for (size_t i = num_segments - 1; i > 0; --i) {
+      second_derivatives[i] = (rhs[i] - upper[i] * second_derivatives[i + 1]) / diagonal[i];
+    }
+    y[1] += gains[1] * second_derivatives[1];
+    y[num_knots - 2] += gains[num_knots - 2] * second_derivatives[num_knots - 2];
+    for (size_t i = 0; i < num_segments; ++i) {
+      double * c = &coefficients_[i * NUM_COEFFICIENTS * num_joints_ + j];
+      c[0] = y[i];
+      c[num_joints_] =
+        slope(i) - h(i) * (2.0 * second_derivatives[i] + second_derivatives[i + 1]) / 6.0;
+      c[2 * num_joints_] = 0.5 * second_derivatives[i];
+      c[3 * num_joints_] = (second_derivatives[i + 1] - second_derivatives[i]) / (6.0 * h(i));
+    }
+  }
+}
+
+inline void CubicSplinePath::evaluate(
+  double time,
+  std::vector<double> & positions,
+  std::vector<double> & velocities,
+  std::vector<double> & accelerations
+)
+{
+  const double t = std::clamp(time, 0.0, times_.back());
+  if (t < times_[cursor_]) {
+    cursor_ = static_cast<size_t>(
+      std::upper_bound(times_.begin(), times_.end(), t) - times_.begin()
+    ) - 1;
+  }
+  while (cursor_ + 2 < times_.size() && t >= times_[cursor_ + 1]) {
+    ++cursor_;
+  }
+  const double tau = t - times_[cursor_];
+  const double * c = &coefficients_[cursor_ * NUM_COEFFICIENTS * num_joints_];
+  for (size_t j = 0; j < num_joints_; ++j) {
+    const double c0 = c[j];
+    const double c1 = c[num_joints_ + j];
+    const double c2 = c[2 * num_joints_ + j];
+    const double c3 = c[3 * num_joints_ + j];
+    positions[j] = c0 + tau * (c1 + tau * (c2 + tau * c3));
+    velocities[j] = c1 + tau * (2.0 * c2 + tau * 3.0 * c3);
+    accelerations[j] = 2.0 * c2 + tau * 6.0 * c3;
+  }
+}
+
+inline size_t CubicSplinePath::get_num_joints() const
+{
+  return num_joints_;
+}
+
+inline double CubicSplinePath::get_duration() const
+{
+  return times_.back();
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_INTERPOLATION_HPP_
@@ -0,0 +1,1683 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_KINEMATICS_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_KINEMATICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <exception>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_type.hpp"
+
+namespace trossen_arm
+{
+
+/// @brief Helpers of the kinematics, not part of the public API
+namespace detail
+{
+
+/// @brief Vector in R^3
+using Vector3 = std::array<double, 3>;
+
+/// @brief 3x3 matrix in row-major order
+using Matrix3 = std::array<double, 9>;
+
+/// @brief Pi, defined here since the POSIX constant is not standard C++
+inline constexpr double PI{3.14159265358979323846};
+
+inline constexpr Matrix3 IDENTITY3{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+inline Vector3 add(const Vector3 & a, const Vector3 & b)
+{
+  return {a[0] + b[0], a[1] + b[1], a[2] + b[2]};
+}
+
+inline Vector3 subtract(const Vector3 & a, const Vector3 & b)
+{
+  return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+inline Vector3 scale(const Vector3 & a, double s)
+{
+  return {a[0] * s, a[1] * s, a[2] * s};
+}
+
+inline double dot(const Vector3 & a, const Vector3 & b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline Vector3 cross(const Vector3 & a, const Vector3 & b)
+{
+  return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+inline Vector3 multiply(const Matrix3 & m, const Vector3 & v)
+{
+  return {
+    m[0] * v[0] + m[1] * v[1] + m[2] * v[2],
+    m[3] * v[0] + m[4] * v[1] + m[5] * v[2],
+    m[6] * v[0] + m[7] * v[1] + m[8] * v[2]
+  };
+}
+
+inline Matrix3 multiply(const Matrix3 & a, const Matrix3 & b)
+{
+  Matrix3 result{};
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      result[3 * i + j] = a[3 * i] * b[j] + a[3 * i + 1] * b[3 + j] + a[3 * i + 2] * b[6 + j];
+    }
+  }
+  return result;
+}
+
+inline Matrix3 transpose(const Matrix3 & m)
+{
+  return {m[0], m[3], m[6], m[1], m[4], m[7], m[2], m[5], m[8]};
+}
+
+/**
+ * @brief Rotation about a unit axis by Rodrigues' formula
+ *
+ * @param axis Unit axis
+ * @param angle Angle in rad
+ * @return Rotation matrix
+ */
+inline Matrix3 rotation_about_axis(const Vector3 & axis, double angle)
+{
+  const double c = std::cos(angle);
+  const double s = std::sin(angle);
+  const double t = 1.0 - c;
+  const double x = axis[0];
+  const double y = axis[1];
+  const double z = axis[2];
+  return {
+    t * x * x + c, t * x * y - s * z, t * x * z + s * y,
+    t * x * y + s * z, t * y * y + c, t * y * z - s * x,
+    t * x * z - s * y, t * y * z + s * x, t * z * z + c
+  };
+}
+
+/**
+ * @brief Rotation from an angle-axis vector
+ *
+ * @param angle_axis Axis scaled by the angle in rad
+ * @return Rotation matrix
+ */
+inline Matrix3 rotation_from_angle_axis(const Vector3 & angle_axis)
+{
+  const double angle = std::sqrt(dot(angle_axis, angle_axis));
+  if (angle < 1e-12) {
+    return {
+      1.0, -angle_axis[2], angle_axis[1],
+      angle_axis[2], 1.0, -angle_axis[0],
+      -angle_axis[1], angle_axis[0], 1.0
+    };
+  }
+  return rotation_about_axis(scale(angle_axis, 1.0 / angle), angle);
+}
+
+/**
+ * @brief Rotation from roll, pitch, and yaw angles about fixed x, y, and z axes
+ *
+ * @param rpy Roll, pitch, and yaw in rad
+ * @return Rotation matrix
+ */
+inline Matrix3 rotation_from_rpy(const Vector3 & rpy)
+{
+  return multiply(
+    rotation_about_axis({0.0, 0.0, 1.0}, rpy[2]),
+    multiply(
+      rotation_about_axis({0.0, 1.0, 0.0}, rpy[1]),
+      rotation_about_axis({1.0, 0.0, 0.0}, rpy[0])
+    )
+  );
+}
+
+/**
+ * @brief Angle-axis vector of a rotation
+ *
+ * @param m Rotation matrix
+ * @return Axis scaled by the angle in [0, pi] rad
+ */
+inline Vector3 angle_axis_from_rotation(const Matrix3 & m)
+{
+  const Vector3 vee{m[7] - m[5], m[2] - m[6], m[3] - m[1]};
+  const double c = std::clamp((m[0] + m[4] + m[8] - 1.0) / 2.0, -1.0, 1.0);
+  const double s = std::sqrt(dot(vee, vee)) / 2.0;
+  const double angle = std::atan2(s, c);
+  if (c > -0.99) {
+    return scale(vee, s < 1e-12 ? 0.5 : angle / (2.0 * s));
+  }
+  // Near pi, recover the axis from the symmetric part R + R^T = 2 c I + 2 (1 - c) a a^T
+  const Matrix3 aat{
+    (m[0] - c) / (1.0 - c), (m[1] + m[3]) / (2.0 * (1.0 - c)), (m[2] + m[6]) / (2.0 * (1.0 - c)),
+    (m[1] + m[3]) / (2.0 * (1.0 - c)), (m[4] - c) / (1.0 - c), (m[5] + m[7]) / (2.0 * (1.0 - c)),
+    (m[2] + m[6]) / (2.0 * (1.0 - c)), (m[5] + m[7]) / (2.0 * (1.0 - c)), (m[8] - c) / (1.0 - c)
+  };
+  size_t k{0};
+  if (aat[4] > aat[3 * k + k]) {
+    k = 1;
+  }
+  if (aat[8] > aat[3 * k + k]) {
+    k = 2;
+  }
+  Vector3 axis{aat[k], aat[3 + k], aat[6 + k]};
+  axis = scale(axis, 1.0 / std::sqrt(std::max(aat[3 * k + k], 1e-300)));
+  if (dot(axis, vee) < 0.0) {
+    axis = scale(axis, -1.0);
+  }
+  return scale(axis, angle);
+}
+
+/**
+ * @brief Solve a linear system in place by Gaussian elimination with partial pivoting
+ *
+ * @tparam N Size of the system
+ * @param a Matrix in row-major order, destroyed
+ * @param b Right-hand side, replaced by the solution
+ * @return false if the matrix is singular
+ */
+template<size_t N>
+bool solve(std::array<double, N * N> & a, std::array<double, N> & b)
+{
+  for (size_t col = 0; col < N; ++col) {
+    size_t pivot = col;
+    for (size_t row = col + 1; row < N; ++row) {
+      if (std::abs(a[row * N + col]) > std::abs(a[pivot * N + col])) {
+        pivot = row;
+      }
+    }
+    if (std::abs(a[pivot * N + col]) < 1e-300) {
+      return false;
+    }
+    if (pivot != col) {
+      for (size_t k = 0; k < N; ++k) {
+        std::swap(a[col * N + k], a[pivot * N + k]);
+      }
+      std::swap(b[col], b[pivot]);
+    }
+    for (size_t row = col + 1; row < N; ++row) {
+      const double factor = a[row * N + col] / a[col * N + col];
+      for (size_t k = col; k < N; ++k) {
+        a[row * N + k] -= factor * a[col * N + k];
+      }
+      b[row] -= factor * b[col];
+    }
+  }
+  for (size_t row = N; row-- > 0; ) {
+    double sum = b[row];
+    for (size_t k = row + 1; k < N; ++k) {
+      sum -= a[row * N + k] * b[k];
+    }
+    b[row] = sum / a[row * N + row];
+  }
+  return true;
+}
+
+}  // namespace detail
+
+/// @brief Result of an inverse kinematics solve
+struct InverseKinematicsResult
+{
+  /// @brief Whether the solution is within the tolerances
+  bool success{false};
+  /// @brief Whether the closed-form solver produced the solution
+  bool analytic{false};
+  /// @brief Number of numeric iterations, refinement of the closed-form solution included
+  uint32_t num_iterations{0};
+  /// @brief Remaining position error in m
+  double position_error{0.0};
+  /// @brief Remaining orientation error in rad
+  double orientation_error{0.0};
+};
+
+/**
+ * @brief Kinematics of the arm joints
+ *
+ * @details The kinematic chain is built from the arm joints, see Joint, and the tool frame, see
+ * EndEffector::t_flange_tool. Cartesian positions are those of the tool frame measured in the base
+ * frame, with the translation first and the angle-axis representation of the rotation last, as in
+ * RobotOutput::Cartesian::positions.
+ *
+ * For chains with the structure of the WXAI V0 and VXAI V0 arms (a vertical base joint, three
+ * parallel pitch joints, and two wrist joints with intersecting axes), inverse kinematics is
+ * solved in closed form. Among the up to eight solutions, the one nearest to the seed is chosen and
+ * refined by a few Newton iterations to absorb small lateral offsets. Near singularities, out of
+ * reach, or for other structures, a damped least squares solver starting from the seed is used.
+ */
+class ArmKinematics
+{
+public:
+  /// @brief Number of arm joints
+  static constexpr size_t NUM_ARM_JOINTS{6};
+
+  /// @brief Positions of the arm joints in rad
+  using JointPositions = std::array<double, NUM_ARM_JOINTS>;
+
+  /// @brief Cartesian positions, translation in m and angle-axis rotation in rad
+  using CartesianPositions = std::array<double, 6>;
+
+  /**
+   * @brief Jacobian in row-major order
+   *
+   * @details Rows are the linear then the angular velocity of the tool frame measured in the base
+   * frame, columns are the arm joints
+   */
+  using Jacobian = std::array<double, 6 * NUM_ARM_JOINTS>;
+
+  /// @brief Position tolerance of inverse kinematics in m
+  static constexpr double POSITION_TOLERANCE{1e-9};
+
+  /// @brief Orientation tolerance of inverse kinematics in rad
+  static constexpr double ORIENTATION_TOLERANCE{1e-9};
+
+  /**
+   * @brief Construct the kinematics
+   *
+   * @param joints Joint kinematic properties, the first NUM_ARM_JOINTS being the arm joints
+   * @param end_effector End effector properties
+   */
+  ArmKinematics(const std::vector<Joint> & joints, const EndEffector & end_effector);
+
+  /**
+   * @brief Compute the Cartesian positions of the tool frame
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @return Cartesian positions
+   */
+  CartesianPositions forward(const JointPositions & joint_positions) const;
+
+  /**
+   * @brief Compute the Jacobian of the tool frame
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @return Jacobian
+   */
+  Jacobian compute_jacobian(const JointPositions & joint_positions) const;
+
+  /**
+   * @brief Compute the positions of the arm joints reaching Cartesian positions
+   *
+   * @param cartesian_positions Goal Cartesian positions
+   * @param seed Positions of the arm joints to stay nearest to, e.g. the current ones
+   * @param joint_positions Positions of the arm joints, the best found even if not successful
+   * @return Result of the solve
+   */
+  InverseKinematicsResult inverse(
+    const CartesianPositions & cartesian_positions,
+    const JointPositions & seed,
+    JointPositions & joint_positions
+  ) const;
+
+  /**
+   * @brief Get whether inverse kinematics has a closed-form solution for this chain
+   *
+   * @return true if the closed-form solver is used
+   */
+  bool has_analytic_solution() const;
+
+private:
+  // Maximum number of damped least squares iterations from the seed
+  static constexpr uint32_t MAX_NUMERIC_ITERATIONS{100};
+
+  // Maximum number of Newton iterations refining a closed-form solution
+  static constexpr uint32_t MAX_REFINEMENT_ITERATIONS{5};
+
+  // Damping of the damped least squares solver added to the squared error, which vanishes near
+  // the solution for quadratic convergence and grows away from it for robustness
+  static constexpr double DAMPING_BIAS{1e-12};
+
+  // Largest joint step of one numeric iteration in rad
+  static constexpr double MAX_STEP{0.5};
+
+  // Pose of a frame measured in the base frame
+  struct Pose
+  {
+    detail::Matrix3 rotation{detail::IDENTITY3};
+    detail::Vector3 translation{};
+  };
+
+  // Translations from the parent link frames to the joint frames
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins_{};
+
+  // Rotations from the parent link frames to the joint frames
+  std::array<detail::Matrix3, NUM_ARM_JOINTS> rotations_{};
+
+  // Whether each joint frame is rotated from its parent link frame
+  std::array<bool, NUM_ARM_JOINTS> rotated_{};
+
+  // Unit rotation axes of the joints expressed in the joint frames
+  std::array<detail::Vector3, NUM_ARM_JOINTS> axes_{};
+
+  // Pose of the tool frame measured in the flange frame
+  Pose flange_tool_{};
+
+  // Whether the chain has the structure solved in closed form
+  bool analytic_{false};
+
+  // Position of joint 1 in the arm plane, radial then vertical, in m
+  std::array<double, 2> shoulder_{};
+
+  // Link from joint 1 to joint 2 in the arm plane in m
+  std::array<double, 2> upper_arm_{};
+
+  // Link from joint 2 to joint 3 in the arm plane in m
+  std::array<double, 2> forearm_{};
+
+  // Link from joint 3 to the intersection of the wrist axes in the arm plane in m
+  std::array<double, 2> wrist_{};
+
+  // Distance from the intersection of the wrist axes to the flange along the last axis in m
+  double flange_offset_{0.0};
+
+  /**
+   * @brief Compute the pose of the flange frame and optionally the joint axes and origins
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @param axes Optional: unit axes of the joints measured in the base frame
+   * @param origins Optional: origins of the joints measured in the base frame
+   * @return Pose of the flange frame
+   */
+  Pose compute_flange_pose(
+    const JointPositions & joint_positions,
+    std::array<detail::Vector3, NUM_ARM_JOINTS> * axes = nullptr,
+    std::array<detail::Vector3, NUM_ARM_JOINTS> * origins = nullptr
+  ) const;
+
+  /**
+   * @brief Compute the pose of the tool frame and its Jacobian
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @param jacobian Jacobian
+   * @return Pose of the tool frame
+   */
+  Pose compute_tool_pose(const JointPositions & joint_positions, Jacobian & jacobian) const;
+
+  /**
+   * @brief Compute the closed-form solution nearest to the seed
+   *
+   * @param goal Goal pose of the tool frame
+   * @param seed Positions of the arm joints to stay nearest to
+   * @param joint_positions Positions of the arm joints
+   * @return false if no regular solution exists
+   */
+  bool solve_analytic(
+    const Pose & goal,
+    const JointPositions & seed,
+    JointPositions & joint_positions
+  ) const;
+
+  /**
+   * @brief Compute the error from a pose to the goal pose
+   *
+   * @param goal Goal pose of the tool frame
+   * @param pose Pose of the tool frame
+   * @param error Position then orientation error measured in the base frame
+   * @param result Result to update with the errors and the success
+   */
+  static void compute_error(
+    const Pose & goal,
+    const Pose & pose,
+    std::array<double, 6> & error,
+    InverseKinematicsResult & result
+  );
+
+  /**
+   * @brief Take one damped least squares step
+   *
+   * @param jacobian Jacobian at the joint positions
+   * @param result Result holding the errors of the joint positions
+   * @param error Position then orientation error, destroyed
+   * @param joint_positions Positions of the arm joints to step
+   * @return false if the step could not be computed
+   */
+  static bool step(
+    const Jacobian & jacobian,
+    const InverseKinematicsResult & result,
+    std::array<double, 6> & error,
+    JointPositions & joint_positions
+  );
+
+  /**
+   * @brief Run damped least squares iterations
+   *
+   * @param goal Goal pose of the tool frame
+   * @param max_iterations Maximum number of iterations
+   * @param joint_positions Positions of the arm joints, the initial guess on input
+   * @param result Result to update with the number of iterations and the errors
+   */
+  void solve_numeric(
+    const Pose & goal,
+    uint32_t max_iterations,
+    JointPositions & joint_positions,
+    InverseKinematicsResult & result
+  ) const;
+
+  friend class IncrementalInverseKinematics;
+};
+
+inline ArmKinematics::ArmKinematics(
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector
+)
+{
+  if (joints.size() < NUM_ARM_JOINTS) {
+    throw LogicError(
+      "Invalid number of joints: " + std::to_string(joints.size()) + " < " +
+      std::to_string(NUM_ARM_JOINTS)
+    );
+  }
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    const Joint & joint = joints[i];
+    const detail::Vector3 axis{joint.axis[0], joint.axis[1], joint.axis[2]};
+    const double norm = std::sqrt(detail::dot(axis, axis));
+    if (norm < 1e-9 || joint.axis[3] != 0.0 || joint.axis[4] != 0.0 || joint.axis[5] != 0.0) {
+      throw LogicError("Arm joint " + std::to_string(i) + " is not a revolute joint");
+    }
+    axes_[i] = detail::scale(axis, 1.0 / norm);
+    origins_[i] = joint.origin_xyz;
+    rotated_[i] = joint.origin_rpy != std::array<double, 3>{};
+    rotations_[i] = detail::rotation_from_rpy(joint.origin_rpy);
+  }
+  flange_tool_.translation = {
+    end_effector.t_flange_tool[0],
+    end_effector.t_flange_tool[1],
+    end_effector.t_flange_tool[2]
+  };
+  flange_tool_.rotation = detail::rotation_from_angle_axis(
+    {end_effector.t_flange_tool[3], end_effector.t_flange_tool[4], end_effector.t_flange_tool[5]}
+  );
+
+  // Check for the structure solved in closed form: axes z, y, -y, -y, -z, x without rotated joint
+  // frames, joint 0 on the vertical axis, and all joints nearly in the arm plane
+  constexpr std::array<detail::Vector3, NUM_ARM_JOINTS> ANALYTIC_AXES{{
+    {0.0, 0.0, 1.0}, {0.0, 1.0, 0.0}, {0.0, -1.0, 0.0},
+    {0.0, -1.0, 0.0}, {0.0, 0.0, -1.0}, {1.0, 0.0, 0.0}
+  }};
+  // Largest lateral offset absorbed by the refinement in m
+  constexpr double MAX_LATERAL_OFFSET{1e-3};
+  analytic_ = std::abs(origins_[0][0]) < 1e-12 && std::abs(origins_[0][1]) < 1e-12;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    analytic_ = analytic_ &&
+      !rotated_[i] &&
+      detail::dot(axes_[i], ANALYTIC_AXES[i]) > 1.0 - 1e-12 &&
+      std::abs(origins_[i][1]) < MAX_LATERAL_OFFSET;
+  }
+  shoulder_ = {origins_[1][0], origins_[0][2] + origins_[1][2]};
+  upper_arm_ = {origins_[2][0], origins_[2][2]};
+  forearm_ = {origins_[3][0], origins_[3][2]};
+  wrist_ = {origins_[4][0], origins_[4][2] + origins_[5][2]};
+  flange_offset_ = origins_[5][0];
+}
+
+inline ArmKinematics::CartesianPositions ArmKinematics::forward(
+  const JointPositions & joint_positions
+) const
+{
+  const Pose flange = compute_flange_pose(joint_positions);
+  const detail::Vector3 translation = detail::add(
+    flange.translation,
+    detail::multiply(flange.rotation, flange_tool_.translation)
+  );
+  const detail::Vector3 angle_axis = detail::angle_axis_from_rotation(
+    detail::multiply(flange.rotation, flange_tool_.rotation)
+  );
+  return {
+    translation[0], translation[1], translation[2],
+    angle_axis[0], angle_axis[1], angle_axis[2]
+  };
+}
+
+inline ArmKinematics::Jacobian ArmKinematics::compute_jacobian(
+  const JointPositions & joint_positions
+) const
+{
+  Jacobian jacobian{};
+  compute_tool_pose(joint_positions, jacobian);
+  return jacobian;
+}
+
+inline InverseKinematicsResult ArmKinematics::inverse(
+  const CartesianPositions & cartesian_positions,
+  const JointPositions & seed,
+  JointPositions & joint_positions
+) const
+{
+  Pose goal;
+  goal.translation = {cartesian_positions[0], cartesian_positions[1], cartesian_positions[2]};
+  goal.rotation = detail::rotation_from_angle_axis(
+    {cartesian_positions[3], cartesian_positions[4], cartesian_positions[5]}
+  );
+
+  InverseKinematicsResult result;
+  if (analytic_ && solve_analytic(goal, seed, joint_positions)) {
+    solve_numeric(goal, MAX_REFINEMENT_ITERATIONS, joint_positions, result);
+    if (result.success) {
+      result.analytic = true;
+      return result;
+    }
+  }
+  joint_positions = seed;
+  result = InverseKinematicsResult{};
+  solve_numeric(goal, MAX_NUMERIC_ITERATIONS, joint_positions, result);
+  return result;
+}
+
+inline bool ArmKinematics::has_analytic_solution() const
+{
+  return analytic_;
+}
+
+inline ArmKinematics::Pose ArmKinematics::compute_flange_pose(
+  const JointPositions & joint_positions,
+  std::array<detail::Vector3, NUM_ARM_JOINTS> * axes,
+  std::array<detail::Vector3, NUM_ARM_JOINTS> * origins
+) const
+{
+  Pose pose;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    pose.translation = detail::add(
+      pose.translation,
+      detail::multiply(pose.rotation, origins_[i])
+    );
+    if (rotated_[i]) {
+      pose.rotation = detail::multiply(pose.rotation, rotations_[i]);
+    }
+    if (axes) {
+      (*axes)[i] = detail::multiply(pose.rotation, axes_[i]);
+    }
+    if (origins) {
+      (*origins)[i] = pose.translation;
+    }
+    pose.rotation = detail::multiply(
+      pose.rotation,
+      detail::rotation_about_axis(axes_[i], joint_positions[i])
+    );
+  }
+  return pose;
+}
+
+inline ArmKinematics::Pose ArmKinematics::compute_tool_pose(
+  const JointPositions & joint_positions,
+  Jacobian & jacobian
+) const
+{
+  std::array<detail::Vector3, NUM_ARM_JOINTS> axes;
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins;
+  const Pose flange = compute_flange_pose(joint_positions, &axes, &origins);
+  Pose tool;
+  tool.translation = detail::add(
+    flange.translation,
+    detail::multiply(flange.rotation, flange_tool_.translation)
+  );
+  tool.rotation = detail::multiply(flange.rotation, flange_tool_.rotation);
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    const detail::Vector3 linear = detail::cross(
+      axes[i],
+      detail::subtract(tool.translation, origins[i])
+    );
+    for (size_t k = 0; k < 3; ++k) {
+      jacobian[k * NUM_ARM_JOINTS + i] = linear[k];
+      jacobian[(k + 3) * NUM_ARM_JOINTS + i] = axes[i][k];
+    }
+  }
+  return tool;
+}
+
+inline bool ArmKinematics::solve_analytic(
+  const Pose & goal,
+  const JointPositions & seed,
+  JointPositions & joint_positions
+) const
+{
+  // Smallest cosine of joint 4 and radius of the wrist center treated as regular
+  constexpr double SINGULARITY_THRESHOLD{1e-6};
+
+  // Pose of the flange frame, whose x axis is the axis of joint 5
+  const detail::Matrix3 rotation = detail::multiply(
+    goal.rotation,
+    detail::transpose(flange_tool_.rotation)
+  );
+  const detail::Vector3 translation = detail::subtract(
+    goal.translation,
+    detail::multiply(rotation, flange_tool_.translation)
+  );
+  const detail::Vector3 axis_5{rotation[0], rotation[3], rotation[6]};
+  // Intersection of the axes of joints 4 and 5
+  const detail::Vector3 wrist_center = detail::subtract(
+    translation,
+    detail::scale(axis_5, flange_offset_)
+  );
+  if (std::hypot(wrist_center[0], wrist_center[1]) < SINGULARITY_THRESHOLD) {
+    return false;
+  }
+
+  auto wrap_near = [](double angle, double reference) {
+      return reference + std::remainder(angle - reference, 2.0 * detail::PI);
+    };
+  auto rotation_y = [](double angle, const std::array<double, 2> & v) {
+      // Rotation about y applied to (x, z) in the arm plane
+      return std::array<double, 2>{
+        v[0] * std::cos(angle) + v[1] * std::sin(angle),
+        -v[0] * std::sin(angle) + v[1] * std::cos(angle)
+      };
+    };
+
+  bool found{false};
+  double best_distance{0.0};
+  const double base_angle = std::atan2(wrist_center[1], wrist_center[0]);
+  for (double q0 : {base_angle, base_angle + detail::PI}) {
+    const double c0 = std::cos(q0);
+    const double s0 = std::sin(q0);
+    // Wrist center and axis of joint 5 in the arm plane frame rotated by joint 0
+    const std::array<double, 2> center{
+      c0 * wrist_center[0] + s0 * wrist_center[1],
+      wrist_center[2]
+    };
+    const detail::Vector3 axis{
+      c0 * axis_5[0] + s0 * axis_5[1],
+      -s0 * axis_5[0] + c0 * axis_5[1],
+      axis_5[2]
+    };
+    const double q4_base = std::asin(std::clamp(-axis[1], -1.0, 1.0));
+    for (double q4 : {q4_base, detail::PI - q4_base}) {
+      const double c4 = std::cos(q4);
+      if (std::abs(c4) < SINGULARITY_THRESHOLD) {
+        continue;
+      }
+      // Pitch of link 3, the sum q1 - q2 - q3
+      const double pitch = std::atan2(-axis[2] / c4, axis[0] / c4);
+      const std::array<double, 2> wrist = rotation_y(pitch, wrist_);
+      const std::array<double, 2> reach{
+        center[0] - wrist[0] - shoulder_[0],
+        center[1] - wrist[1] - shoulder_[1]
+      };
+      // Law of cosines of the two-link chain from joint 1 to joint 3
+      const double a_dot_b = upper_arm_[0] * forearm_[0] + upper_arm_[1] * forearm_[1];
+      const double a_cross_b = upper_arm_[1] * forearm_[0] - upper_arm_[0] * forearm_[1];
+      const double k = (
+        reach[0] * reach[0] + reach[1] * reach[1] -
+        upper_arm_[0] * upper_arm_[0] - upper_arm_[1] * upper_arm_[1] -
+        forearm_[0] * forearm_[0] - forearm_[1] * forearm_[1]
+      ) / 2.0;
+      const double rho = std::hypot(a_dot_b, a_cross_b);
+      if (rho < SINGULARITY_THRESHOLD || std::abs(k / rho) > 1.0) {
+        continue;
+      }
+      const double gamma = std::atan2(a_cross_b, a_dot_b);
+      const double elbow = std::acos(k / rho);
+      for (double q2 : {gamma + elbow, gamma - elbow}) {
+        const std::array<double, 2> forearm = rotation_y(-q2, forearm_);
+        const std::array<double, 2> chain{
+          upper_arm_[0] + forearm[0],
+          upper_arm_[1] + forearm[1]
+        };
+        const double q1 = std::atan2(chain[1], chain[0]) - std::atan2(reach[1], reach[0]);
+        const double q3 = q1 - q2 - pitch;
+        // Joint 5 from the remaining rotation R_x(q5) = (R_z(q0) R_y(pitch) R_z(-q4))^T R
+        const detail::Matrix3 arm_rotation = detail::multiply(
+          detail::rotation_about_axis({0.0, 0.0, 1.0}, q0),
+          detail::multiply(
+            detail::rotation_about_axis({0.0, 1.0, 0.0}, pitch),
+            detail::rotation_about_axis({0.0, 0.0, 1.0}, -q4)
+          )
+        );
+        const detail::Matrix3 remaining = detail::multiply(
+          detail::transpose(arm_rotation),
+          rotation
+        );
+        const double q5 = std::atan2(remaining[7], remaining[4]);
+
+        JointPositions candidate{q0, q1, q2, q3, q4, q5};
+        double distance{0.0};
+        for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+          candidate[i] = wrap_near(candidate[i], seed[i]);
+          distance += (candidate[i] - seed[i]) * (candidate[i] - seed[i]);
+        }
+        if (!found || distance < best_distance) {
+          found = true;
+          best_distance = distance;
+          joint_positions = candidate;
+        }
+      }
+    }
+  }
+  return found;
+}
+
+inline void ArmKinematics::compute_error(
+  const Pose & goal,
+  const Pose & pose,
+  std::array<double, 6> & error,
+  InverseKinematicsResult & result
+)
+{
+  const detail::Vector3 position_error = detail::subtract(goal.translation, pose.translation);
+  const detail::Vector3 orientation_error = detail::angle_axis_from_rotation(
+    detail::multiply(goal.rotation, detail::transpose(pose.rotation))
+  );
+  error = {
+    position_error[0], position_error[1], position_error[2],
+    orientation_error[0], orientation_error[1], orientation_error[2]
+  };
+  result.position_error = std::sqrt(detail::dot(position_error, position_error));
+  result.orientation_error = std::sqrt(detail::dot(orientation_error, orientation_error));
+  result.success =
+    result.position_error < POSITION_TOLERANCE &&
+    result.orientation_error < ORIENTATION_TOLERANCE;
+}
+
+inline bool ArmKinematics::step(
+  const Jacobian & jacobian,
+  const InverseKinematicsResult & result,
+  std::array<double, 6> & error,
+  JointPositions & joint_positions
+)
+{
+  // Damped least squares step J^T (J J^T + lambda^2 I)^-1 e
+  const double damping =
+    result.position_error * result.position_error +
+    result.orientation_error * result.orientation_error + DAMPING_BIAS;
+  std::array<double, 36> jjt{};
+  for (size_t r = 0; r < 6; ++r) {
+    for (size_t c = 0; c < 6; ++c) {
+      double sum = r == c ? damping : 0.0;
+      for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+        sum += jacobian[r * NUM_ARM_JOINTS + i] * jacobian[c * NUM_ARM_JOINTS + i];
+      }
+      jjt[r * 6 + c] = sum;
+    }
+  }
+  if (!detail::solve<6>(jjt, error)) {
+    return false;
+  }
+  JointPositions delta{};
+  double largest_delta{0.0};
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    for (size_t r = 0; r < 6; ++r) {
+      delta[i] += jacobian[r * NUM_ARM_JOINTS + i] * error[r];
+    }
+    largest_delta = std::max(largest_delta, std::abs(delta[i]));
+  }
+  const double delta_scale = largest_delta > MAX_STEP ? MAX_STEP / largest_delta : 1.0;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    joint_positions[i] += delta_scale * delta[i];
+  }
+  return true;
+}
+
+inline void ArmKinematics::solve_numeric(
+  const Pose & goal,
+  uint32_t max_iterations,
+  JointPositions & joint_positions,
+  InverseKinematicsResult & result
+) const
+{
+  Jacobian jacobian;
+  std::array<double, 6> error;
+  for (uint32_t iteration = 0; ; ++iteration) {
+    compute_error(goal, compute_tool_pose(joint_positions, jacobian), error, result);
+    if (result.success || iteration == max_iterations) {
+      return;
+    }
+    ++result.num_iterations;
+    if (!step(jacobian, result, error, joint_positions)) {
+      return;
+    }
+  }
+}
+
+/// @brief Convergence statistics of incremental inverse kinematics
+struct IncrementalInverseKinematicsStatistics
+{
+  /// @brief Number of solves
+  uint64_t num_solves{0};
+  /// @brief Number of solves within the tolerances
+  uint64_t num_converged{0};
+  /// @brief Number of solves stopped at the iteration cap before reaching the tolerances
+  uint64_t num_capped{0};
+  /// @brief Total number of iterations
+  uint64_t num_iterations{0};
+  /// @brief Largest number of iterations of one solve
+  uint32_t max_iterations{0};
+  /// @brief Largest remaining position error of one solve in m
+  double max_position_error{0.0};
+  /// @brief Largest remaining orientation error of one solve in rad
+  double max_orientation_error{0.0};
+};
+
+/**
+ * @brief Incremental inverse kinematics for goals advancing in small steps
+ *
+ * @details Every solve warm-starts from the previous solution and takes its first step with the
+ * pose and Jacobian already computed at that solution, so a solve converging in one step costs
+ * exactly one evaluation of forward kinematics and the Jacobian. The number of iterations per
+ * solve is capped to bound the worst-case cost; a capped solve returns its best positions and the
+ * next solve continues from them.
+ *
+ * Call reset() with the measured joint positions before the first solve and whenever the
+ * goals jump, e.g. when a new trajectory starts.
+ */
+class IncrementalInverseKinematics
+{
+public:
+  /**
+   * @brief Construct the incremental inverse kinematics
+   *
+   * @param kinematics Kinematics of the arm, must outlive this object
+   * @param max_iterations Optional: maximum number of iterations per solve, default 2
+   */
+  explicit IncrementalInverseKinematics(
+    const ArmKinematics & kinematics,
+    uint32_t max_iterations = 2
+  );
+
+  /**
+   * @brief Restart from given positions of the arm joints
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   */
+  void reset(const ArmKinematics::JointPositions & joint_positions);
+
+  /**
+   * @brief Solve for the next goal
+   *
+   * @param cartesian_positions Goal Cartesian positions
+   * @param joint_positions Positions of the arm joints, the best found even if not converged
+   * @return Result of the solve
+   */
+  InverseKinematicsResult solve(
+    const ArmKinematics::CartesianPositions & cartesian_positions,
+    ArmKinematics::JointPositions & joint_positions
+  );
+
+  /**
+   * @brief Get the convergence statistics since construction or the last reset of the statistics
+   *
+   * @return Convergence statistics
+   */
+  const IncrementalInverseKinematicsStatistics & get_statistics() const;
+
+  /// @brief Reset the convergence statistics
+  void reset_statistics();
+
+private:
+  // Kinematics of the arm
+  const ArmKinematics & kinematics_;
+
+  // Maximum number of iterations per solve
+  uint32_t max_iterations_{0};
+
+  // Latest solution
+  ArmKinematics::JointPositions joint_positions_{};
+
+  // Pose of the tool frame at the latest solution
+  ArmKinematics::Pose pose_{};
+
+  // Jacobian at the latest solution
+  ArmKinematics::Jacobian jacobian_{};
+
+  // Convergence statistics
+  IncrementalInverseKinematicsStatistics statistics_{};
+};
+
+inline IncrementalInverseKinematics::IncrementalInverseKinematics(
+  const ArmKinematics & kinematics,
+  uint32_t max_iterations
+)
+: kinematics_(kinematics),
+  max_iterations_(max_iterations)
+{
+  if (max_iterations_ == 0) {
+    throw LogicError("The maximum number of iterations must be positive");
+  }
+  reset(ArmKinematics::JointPositions{});
+}
+
+inline void IncrementalInverseKinematics::reset(
+  const ArmKinematics::JointPositions & joint_positions
+)
+{
+  joint_positions_ = joint_positions;
+  pose_ = kinematics_.compute_tool_pose(joint_positions_, jacobian_);
+}
+
+inline InverseKinematicsResult IncrementalInverseKinematics::solve(
+  const ArmKinematics::CartesianPositions & cartesian_positions,
+  ArmKinematics::JointPositions & joint_positions
+)
+{
+  ArmKinematics::Pose goal;
+  goal.translation = {cartesian_positions[0], cartesian_positions[1], cartesian_positions[2]};
+  goal.rotation = detail::rotation_from_angle_axis(
+    {cartesian_positions[3], cartesian_positions[4], cartesian_positions[5]}
+  );
+
+  InverseKinematicsResult result;
+  std::array<double, 6> error;
+  ArmKinematics::compute_error(goal, pose_, error, result);
+  while (!result.success && result.num_iterations < max_iterations_) {
+    ++result.num_iterations;
+    if (!ArmKinematics::step(jacobian_, result, error, joint_positions_)) {
+      break;
+    }
+    pose_ = kinematics_.compute_tool_pose(joint_positions_, jacobian_);
+    ArmKinematics::compute_error(goal, pose_, error, result);
+  }
+  joint_positions = joint_positions_;
+
+  ++statistics_.num_solves;
+  statistics_.num_converged += result.success;
+  statistics_.num_capped += !result.success && result.num_iterations == max_iterations_;
+  statistics_.num_iterations += result.num_iterations;
+  statistics_.max_iterations = std::max(statistics_.max_iterations, result.num_iterations);
+  statistics_.max_position_error = std::max(
+    statistics_.max_position_error,
+    result.position_error
+  );
+  statistics_.max_orientation_error = std::max(
+    statistics_.max_orientation_error,
+    result.orientation_error
+  );
+  return result;
+}
+
+inline const IncrementalInverseKinematicsStatistics &
+IncrementalInverseKinematics::get_statistics() const
+{
+  return statistics_;
+}
+
+inline void IncrementalInverseKinematics::reset_statistics()
+{
+  statistics_ = IncrementalInverseKinematicsStatistics{};
+}
+
+/**
+ * @brief Compile-time kinematic structure of a model
+ *
+ * @tparam M Model
+ *
+ * @details Each specialization provides the number of joints, the axis and sign of every arm joint
+ * rotation, and the default joint origins in the home configuration.
+ */
+template<Model M>
+struct ModelKinematics;
+
+/// @brief Compile-time kinematic structure of the WXAI V0
+template<>
+struct ModelKinematics<Model::wxai_v0>
+{
+  /// @brief Number of joints, the gripper joint included
+  static constexpr uint8_t NUM_JOINTS{7};
+
+  /// @brief Number of arm joints
+  static constexpr size_t NUM_ARM_JOINTS{6};
+
+  /// @brief Index of the axis of every arm joint in its joint frame, 0 for x, 1 for y, 2 for z
+  static constexpr std::array<uint8_t, NUM_ARM_JOINTS> AXES{2, 1, 1, 1, 2, 0};
+
+  /// @brief Sign of the axis of every arm joint
+  static constexpr std::array<double, NUM_ARM_JOINTS> AXIS_SIGNS{1.0, 1.0, -1.0, -1.0, -1.0, 1.0};
+
+  /// @brief Translations from the parent link frames to the arm joint frames in m, as in
+  /// StandardJoints::wxai_v0_20260626, which tests/cpp/test_kinematics.cpp checks
+  static constexpr std::array<std::array<double, 3>, NUM_ARM_JOINTS> ORIGINS{{
+    {0.0, 0.0, 0.05725},
+    {0.02, 0.0, 0.04625},
+    {-0.264, 0.0, 0.0},
+    {0.245, 0.0, 0.06},
+    {0.06775, -0.00005, 0.0455},
+    {0.02895, 0.0, -0.0455}
+  }};
+};
+
+/// @brief Compile-time kinematic structure of the VXAI V0 RIGHT, sharing the WXAI V0 arm
+template<>
+struct ModelKinematics<Model::vxai_v0_right> : ModelKinematics<Model::wxai_v0> {};
+
+/// @brief Compile-time kinematic structure of the VXAI V0 LEFT, sharing the WXAI V0 arm
+template<>
+struct ModelKinematics<Model::vxai_v0_left> : ModelKinematics<Model::wxai_v0> {};
+
+/**
+ * @brief Kinematics specialized at compile time for a model
+ *
+ * @tparam M Model
+ *
+ * @details The number of joints and the axis of every joint are compile-time constants, so all
+ * loops have fixed trip counts that the compiler unrolls, each joint rotation only touches the two
+ * columns it mixes, and no memory is allocated. Only the joint origins and the tool frame are
+ * runtime values, defaulting to ModelKinematics<M>::ORIGINS.
+ *
+ * Inverse kinematics is delegated to ArmKinematics built from the same geometry.
+ */
+template<Model M>
+class Kinematics
+{
+public:
+  /// @brief Number of joints, the gripper joint included
+  static constexpr uint8_t NUM_JOINTS{ModelKinematics<M>::NUM_JOINTS};
+
+  /// @brief Number of arm joints
+  static constexpr size_t NUM_ARM_JOINTS{ModelKinematics<M>::NUM_ARM_JOINTS};
+
+  /// @brief Positions of the arm joints in rad
+  using JointPositions = std::array<double, NUM_ARM_JOINTS>;
+
+  /// @brief Cartesian positions, translation in m and angle-axis rotation in rad
+  using CartesianPositions = std::array<double, 6>;
+
+  /// @brief Jacobian in row-major order, see ArmKinematics::Jacobian
+  using Jacobian = std::array<double, 6 * NUM_ARM_JOINTS>;
+
+  /**
+   * @brief Construct the kinematics with the default joint origins of the model
+   *
+   * @param end_effector End effector properties
+   */
+  explicit Kinematics(const EndEffector & end_effector);
+
+  /**
+   * @brief Construct the kinematics with given joint origins
+   *
+   * @param joints Joint kinematic properties, e.g. from TrossenArmDriver::get_joints()
+   * @param end_effector End effector properties
+   *
+   * @note The joint axes must match the model and the joint frames must not be rotated
+   */
+  Kinematics(const std::vector<Joint> & joints, const EndEffector & end_effector);
+
+  /**
+   * @brief Get whether joint kinematic properties match the kinematic structure of the model
+   *
+   * @param joints Joint kinematic properties
+   * @return true if the joint axes match the model and the joint frames are not rotated
+   */
+  static bool is_compatible(const std::vector<Joint> & joints);
+
+  /**
+   * @brief Compute the Cartesian positions of the tool frame
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @return Cartesian positions
+   */
+  CartesianPositions forward(const JointPositions & joint_positions) const;
+
+  /**
+   * @brief Compute the Cartesian positions and the Jacobian of the tool frame in one pass
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @param jacobian Jacobian
+   * @return Cartesian positions
+   */
+  CartesianPositions forward(const JointPositions & joint_positions, Jacobian & jacobian) const;
+
+  /**
+   * @brief Compute the positions of the arm joints reaching Cartesian positions
+   *
+   * @param cartesian_positions Goal Cartesian positions
+   * @param seed Positions of the arm joints to stay nearest to
+   * @param joint_positions Positions of the arm joints
+   * @return Result of the solve, see ArmKinematics::inverse()
+   */
+  InverseKinematicsResult inverse(
+    const CartesianPositions & cartesian_positions,
+    const JointPositions & seed,
+    JointPositions & joint_positions
+  ) const;
+
+private:
+  // Translations from the parent link frames to the arm joint frames
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins_{ModelKinematics<M>::ORIGINS};
+
+  // Translation of the tool frame in the flange frame
+  detail::Vector3 tool_translation_{};
+
+  // Rotation of the tool frame in the flange frame
+  detail::Matrix3 tool_rotation_{detail::IDENTITY3};
+
+  // Solver of inverse kinematics
+  ArmKinematics inverse_kinematics_;
+
+  /**
+   * @brief Construct the kinematics from validated joint origins
+   *
+   * @param origins Translations from the parent link frames to the arm joint frames
+   * @param joints Joint kinematic properties with the same origins, for the inverse kinematics
+   * @param end_effector End effector properties
+   */
+  Kinematics(
+    const std::array<detail::Vector3, NUM_ARM_JOINTS> & origins,
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector
+  );
+
+  /**
+   * @brief Get the joint origins of compatible joint kinematic properties
+   *
+   * @param joints Joint kinematic properties
+   * @return Translations from the parent link frames to the arm joint frames
+   *
+   * @note A LogicError is thrown if the joints are not compatible, see is_compatible()
+   */
+  static std::array<detail::Vector3, NUM_ARM_JOINTS> get_origins(
+    const std::vector<Joint> & joints
+  );
+
+  /**
+   * @brief Build the joint kinematic properties of the current geometry
+   *
+   * @param origins Translations from the parent link frames to the arm joint frames
+   * @return Joint kinematic properties of the arm joints
+   */
+  static std::vector<Joint> make_joints(
+    const std::array<detail::Vector3, NUM_ARM_JOINTS> & origins
+  );
+
+  /**
+   * @brief Apply a joint rotation to the columns of a rotation matrix
+   *
+   * @tparam I Index of the joint
+   * @param rotation Rotation matrix, multiplied on the right by the joint rotation
+   * @param angle Joint position in rad
+   */
+  template<size_t I>
+  static void rotate(detail::Matrix3 & rotation, double angle);
+
+  /**
+   * @brief Compute the tool pose and optionally the Jacobian
+   *
+   * @param joint_positions Positions of the arm joints in rad
+   * @param jacobian Optional: Jacobian
+   * @param std::index_sequence Indices of the arm joints
+   * @return Cartesian positions
+   */
+  template<size_t... I>
+  CartesianPositions compute(
+    const JointPositions & joint_positions,
+    Jacobian * jacobian,
+    std::index_sequence<I...>
+  ) const;
+};
+
+template<Model M>
+Kinematics<M>::Kinematics(const EndEffector & end_effector)
+: Kinematics(ModelKinematics<M>::ORIGINS, make_joints(ModelKinematics<M>::ORIGINS), end_effector)
+{
+}
+
+template<Model M>
+Kinematics<M>::Kinematics(const std::vector<Joint> & joints, const EndEffector & end_effector)
+: Kinematics(get_origins(joints), joints, end_effector)
+{
+}
+
+template<Model M>
+Kinematics<M>::Kinematics(
+  const std::array<detail::Vector3, NUM_ARM_JOINTS> & origins,
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector
+)
+: origins_(origins),
+  tool_translation_{
+    end_effector.t_flange_tool[0],
+    end_effector.t_flange_tool[1],
+    end_effector.t_flange_tool[2]
+  },
+  tool_rotation_(
+    detail::rotation_from_angle_axis(
+      {end_effector.t_flange_tool[3], end_effector.t_flange_tool[4], end_effector.t_flange_tool[5]}
+    )
+  ),
+  inverse_kinematics_(joints, end_effector)
+{
+}
+
+template<Model M>
+std::array<detail::Vector3, Kinematics<M>::NUM_ARM_JOINTS> Kinematics<M>::get_origins(
+  const std::vector<Joint> & joints
+)
+{
+  if (!is_compatible(joints)) {
+    throw LogicError("Joints do not match the kinematic structure of " + MODEL_NAME.at(M));
+  }
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins;
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    origins[i] = joints[i].origin_xyz;
+  }
+  return origins;
+}
+
+template<Model M>
+bool Kinematics<M>::is_compatible(const std::vector<Joint> & joints)
+{
+  if (joints.size() < NUM_ARM_JOINTS) {
+    return false;
+  }
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    std::array<double, 6> axis{};
+    axis[ModelKinematics<M>::AXES[i]] = ModelKinematics<M>::AXIS_SIGNS[i];
+    if (joints[i].axis != axis || joints[i].origin_rpy != std::array<double, 3>{}) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template<Model M>
+typename Kinematics<M>::CartesianPositions Kinematics<M>::forward(
+  const JointPositions & joint_positions
+) const
+{
+  return compute(joint_positions, nullptr, std::make_index_sequence<NUM_ARM_JOINTS>{});
+}
+
+template<Model M>
+typename Kinematics<M>::CartesianPositions Kinematics<M>::forward(
+  const JointPositions & joint_positions,
+  Jacobian & jacobian
+) const
+{
+  return compute(joint_positions, &jacobian, std::make_index_sequence<NUM_ARM_JOINTS>{});
+}
+
+template<Model M>
+InverseKinematicsResult Kinematics<M>::inverse(
+  const CartesianPositions & cartesian_positions,
+  const JointPositions & seed,
+  JointPositions & joint_positions
+) const
+{
+  return inverse_kinematics_.inverse(cartesian_positions, seed, joint_positions);
+}
+
+template<Model M>
+std::vector<Joint> Kinematics<M>::make_joints(
+  const std::array<detail::Vector3, NUM_ARM_JOINTS> & origins
+)
+{
+  std::vector<Joint> joints(NUM_ARM_JOINTS);
+  for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+    joints[i].axis[ModelKinematics<M>::AXES[i]] = ModelKinematics<M>::AXIS_SIGNS[i];
+    joints[i].origin_xyz = origins[i];
+  }
+  return joints;
+}
+
+template<Model M>
+template<size_t I>
+void Kinematics<M>::rotate(detail::Matrix3 & rotation, double angle)
+{
+  constexpr uint8_t AXIS{ModelKinematics<M>::AXES[I]};
+  // The two columns mixed by a rotation about the axis, in right-handed order
+  constexpr size_t A{(AXIS + 1) % 3};
+  constexpr size_t B{(AXIS + 2) % 3};
+  const double c = std::cos(angle);
+  const double s = ModelKinematics<M>::AXIS_SIGNS[I] * std::sin(angle);
+  for (size_t row = 0; row < 3; ++row) {
+    const double a = rotation[3 * row + A];
+    const double b = rotation[3 * row + B];
+    rotation[3 * row + A] = c * a + s * b;
+    rotation[3 * row + B] = -s * a + c * b;
+  }
+}
+
+template<Model M>
+template<size_t... I>
+typename Kinematics<M>::CartesianPositions Kinematics<M>::compute(
+  const JointPositions & joint_positions,
+  Jacobian * jacobian,
+  std::index_sequence<I...>
+) const
+{
+  detail::Matrix3 rotation{detail::IDENTITY3};
+  detail::Vector3 translation{};
+  std::array<detail::Vector3, NUM_ARM_JOINTS> axes{};
+  std::array<detail::Vector3, NUM_ARM_JOINTS> origins{};
+  auto step = [&](auto index) {
+      constexpr size_t J{decltype(index)::value};
+      translation = detail::add(translation, detail::multiply(rotation, origins_[J]));
+      constexpr uint8_t AXIS{ModelKinematics<M>::AXES[J]};
+      axes[J] = detail::scale(
+        {rotation[AXIS], rotation[3 + AXIS], rotation[6 + AXIS]},
+        ModelKinematics<M>::AXIS_SIGNS[J]
+      );
+      origins[J] = translation;
+      rotate<J>(rotation, joint_positions[J]);
+    };
+  (step(std::integral_constant<size_t, I>{}), ...);
+
+  translation = detail::add(translation, detail::multiply(rotation, tool_translation_));
+  rotation = detail::multiply(rotation, tool_rotation_);
+  if (jacobian) {
+    for (size_t i = 0; i < NUM_ARM_JOINTS; ++i) {
+      const detail::Vector3 linear = detail::cross(
+        axes[i],
+        detail::subtract(translation, origins[i])
+      );
+      for (size_t k = 0; k < 3; ++k) {
+        (*jacobian)[k * NUM_ARM_JOINTS + i] = linear[k];
+        (*jacobian)[(k + 3) * NUM_ARM_JOINTS + i] = axes[i][k];
+      }
+    }
+  }
+  const detail::Vector3 angle_axis = detail::angle_axis_from_rotation(rotation);
+  return {
+    translation[0], translation[1], translation[2],
+    angle_axis[0], angle_axis[1], angle_axis[2]
+  };
+}
+
+namespace detail
+{
+
+/**
+ * @brief Run a function over contiguous chunks of a range in parallel
+ *
+ * @param size Size of the range
+ * @param num_threads Number of threads, 0 for the hardware concurrency
+ * @param function Function called with the begin and end of every chunk
+ *
+ * @note If function throws in any chunk, the first exception by chunk order is rethrown once all
+ * chunks are done
+ */
+template<typename Function>
+void parallel_for(size_t size, size_t num_threads, const Function & function)
+{
+  if (num_threads == 0) {
+    num_threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+  }
+  num_threads = std::min(num_threads, size);
+  if (num_threads <= 1) {
+    function(0, size);
+    return;
+  }
+  const size_t chunk = (size + num_threads - 1) / num_threads;
+  // Exception caught in every chunk, rethrown after joining since threads cannot propagate them
+  std::vector<std::exception_ptr> exception_ptrs((size + chunk - 1) / chunk);
+  auto run_chunk = [&function, &exception_ptrs, chunk, size](size_t index) {
+      try {
+        const size_t begin = index * chunk;
+        function(begin, std::min(begin + chunk, size));
+      } catch (...) {
+        exception_ptrs[index] = std::current_exception();
+      }
+    };
+  std::vector<std::thread> threads;
+  threads.reserve(exception_ptrs.size() - 1);
+  for (size_t index = 1; index < exception_ptrs.size(); ++index) {
+    threads.emplace_back(run_chunk, index);
+  }
+  run_chunk(0);
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto & exception_ptr : exception_ptrs) {
+    if (exception_ptr) {
+      std::rethrow_exception(exception_ptr);
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Stateless kinematics of batches of configurations
+ *
+ * @details The batches are split into contiguous chunks processed in parallel, one per thread.
+ * Joint positions, Cartesian positions, and Jacobians are stored contiguously, one fixed-size
+ * array per configuration. When the joints match the kinematic structure of the model, forward
+ * kinematics and Jacobians use Kinematics<Model>, else ArmKinematics.
+ *
+ * No arm controller is needed, so recorded episodes can be labeled offline, e.g. with joints
+ * from StandardJoints and an end effector from StandardEndEffector.
+ */
+class BatchKinematics
+{
+public:
+  /**
+   * @brief Compute the Cartesian positions of the tool frame for every configuration
+   *
+   * @param model Model of the arm
+   * @param joints Joint kinematic properties, the first six being the arm joints
+   * @param end_effector End effector properties
+   * @param joint_positions Positions of the arm joints in rad of every configuration
+   * @param num_threads Optional: number of threads, default 0 for the hardware concurrency
+   * @return Cartesian positions of every configuration
+   */
+  static std::vector<ArmKinematics::CartesianPositions> forward(
+    Model model,
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector,
+    const std::vector<ArmKinematics::JointPositions> & joint_positions,
+    size_t num_threads = 0
+  );
+
+  /**
+   * @brief Compute the Jacobian of the tool frame for every configuration
+   *
+   * @param model Model of the arm
+   * @param joints Joint kinematic properties, the first six being the arm joints
+   * @param end_effector End effector properties
+   * @param joint_positions Positions of the arm joints in rad of every configuration
+   * @param num_threads Optional: number of threads, default 0 for the hardware concurrency
+   * @return Jacobian of every configuration, see ArmKinematics::Jacobian
+   */
+  static std::vector<ArmKinematics::Jacobian> compute_jacobians(
+    Model model,
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector,
+    const std::vector<ArmKinematics::JointPositions> & joint_positions,
+    size_t num_threads = 0
+  );
+
+  /**
+   * @brief Compute the positions of the arm joints reaching every Cartesian positions
+   *
+   * @param joints Joint kinematic properties, the first six being the arm joints
+   * @param end_effector End effector properties
+   * @param cartesian_positions Goal Cartesian positions of every configuration
+   * @param seeds Positions of the arm joints to stay nearest to, one for all configurations or one
+   * per configuration
+   * @param joint_positions Positions of the arm joints of every configuration
+   * @param num_threads Optional: number of threads, default 0 for the hardware concurrency
+   * @return Result of the solve of every configuration
+   *
+   * @note Inverse kinematics always uses ArmKinematics, so unlike the other batches it takes no
+   * model
+   */
+  static std::vector<InverseKinematicsResult> inverse(
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector,
+    const std::vector<ArmKinematics::CartesianPositions> & cartesian_positions,
+    const std::vector<ArmKinematics::JointPositions> & seeds,
+    std::vector<ArmKinematics::JointPositions> & joint_positions,
+    size_t num_threads = 0
+  );
+
+private:
+  /**
+   * @brief Call a function with the kinematics suited to the joints
+   *
+   * @param model Model of the arm
+   * @param joints Joint kinematic properties
+   * @param end_effector End effector properties
+   * @param function Function called with Kinematics<Model> if compatible, else ArmKinematics
+   */
+  template<typename Function>
+  static void dispatch(
+    Model model,
+    const std::vector<Joint> & joints,
+    const EndEffector & end_effector,
+    const Function & function
+  );
+};
+
+inline std::vector<ArmKinematics::CartesianPositions> BatchKinematics::forward(
+  Model model,
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector,
+  const std::vector<ArmKinematics::JointPositions> & joint_positions,
+  size_t num_threads
+)
+{
+  std::vector<ArmKinematics::CartesianPositions> cartesian_positions(joint_positions.size());
+  dispatch(
+    model,
+    joints,
+    end_effector,
+    [&](const auto & kinematics) {
+      detail::parallel_for(
+        joint_positions.size(),
+        num_threads,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            cartesian_positions[i] = kinematics.forward(joint_positions[i]);
+          }
+        }
+      );
+    }
+  );
+  return cartesian_positions;
+}
+
+inline std::vector<ArmKinematics::Jacobian> BatchKinematics::compute_jacobians(
+  Model model,
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector,
+  const std::vector<ArmKinematics::JointPositions> & joint_positions,
+  size_t num_threads
+)
+{
+  std::vector<ArmKinematics::Jacobian> jacobians(joint_positions.size());
+  dispatch(
+    model,
+    joints,
+    end_effector,
+    [&](const auto & kinematics) {
+      detail::parallel_for(
+        joint_positions.size(),
+        num_threads,
+        [&](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(kinematics)>, ArmKinematics>) {
+              jacobians[i] = kinematics.compute_jacobian(joint_positions[i]);
+            } else {
+              kinematics.forward(joint_positions[i], jacobians[i]);
+            }
+          }
+        }
+      );
+    }
+  );
+  return jacobians;
+}
+
+inline std::vector<InverseKinematicsResult> BatchKinematics::inverse(
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector,
+  const std::vector<ArmKinematics::CartesianPositions> & cartesian_positions,
+  const std::vector<ArmKinematics::JointPositions> & seeds,
+  std::vector<ArmKinematics::JointPositions> & joint_positions,
+  size_t num_threads
+)
+{
+  if (seeds.size() != 1 && seeds.size() != cartesian_positions.size()) {
+    throw LogicError(
+      "Invalid number of seeds: " + std::to_string(seeds.size()) + " is neither 1 nor " +
+      std::to_string(cartesian_positions.size())
+    );
+  }
+  const ArmKinematics kinematics(joints, end_effector);
+  std::vector<InverseKinematicsResult> results(cartesian_positions.size());
+  joint_positions.resize(cartesian_positions.size());
+  detail::parallel_for(
+    cartesian_positions.size(),
+    num_threads,
+    [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        results[i] = kinematics.inverse(
+          cartesian_positions[i],
+          seeds.size() == 1 ? seeds.front() : seeds[i],
+          joint_positions[i]
+        );
+      }
+    }
+  );
+  return results;
+}
+
+template<typename Function>
+void BatchKinematics::dispatch(
+  Model model,
+  const std::vector<Joint> & joints,
+  const EndEffector & end_effector,
+  const Function & function
+)
+{
+  switch (model) {
+    case Model::wxai_v0:
+      if (Kinematics<Model::wxai_v0>::is_compatible(joints)) {
+        function(Kinematics<Model::wxai_v0>(joints, end_effector));
+        return;
+      }
+      break;
+    case Model::vxai_v0_right:
+      if (Kinematics<Model::vxai_v0_right>::is_compatible(joints)) {
+        function(Kinematics<Model::vxai_v0_right>(joints, end_effector));
+        return;
+      }
+      break;
+    case Model::vxai_v0_left:
+      if (Kinematics<Model::vxai_v0_left>::is_compatible(joints)) {
+        function(Kinematics<Model::vxai_v0_left>(joints, end_effector));
+        return;
+      }
+      break;
+    default:
+      throw LogicError("Unknown model");
+  }
+  function(ArmKinematics(joints, end_effector));
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_KINEMATICS_HPP_
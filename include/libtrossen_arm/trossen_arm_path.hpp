@@ -0,0 +1,137 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_PATH_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_PATH_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm.hpp"
+#include "libtrossen_arm/trossen_arm_interpolation.hpp"
+
+namespace trossen_arm
+{
+
+/**
+ * @brief Fit a path from the current positions of a driver through waypoints
+ *
+ * @param driver The configured driver whose joints follow the path
+ * @param waypoints Positions of all joints at every waypoint in rad for arm joints and m for the
+ * gripper joint
+ * @param times Times in s from now at which every waypoint should be reached, strictly
+ * increasing from above 0.0
+ * @return Path starting from the current positions at time 0, see CubicSplinePath
+ */
+inline CubicSplinePath make_position_path(
+  TrossenArmDriver & driver,
+  const std::vector<std::vector<double>> & waypoints,
+  const std::vector<double> & times
+)
+{
+  if (waypoints.size() != times.size()) {
+    throw LogicError(
+      "Invalid number of waypoint times: " + std::to_string(times.size()) + " != " +
+      std::to_string(waypoints.size())
+    );
+  }
+  // Start the path from the current positions at time 0
+  std::vector<std::vector<double>> path_waypoints{driver.get_all_positions()};
+  path_waypoints.insert(path_waypoints.end(), waypoints.begin(), waypoints.end());
+  std::vector<double> path_times{0.0};
+  path_times.insert(path_times.end(), times.begin(), times.end());
+  CubicSplinePath path(path_waypoints, path_times);
+  if (path.get_num_joints() != driver.get_num_joints()) {
+    throw LogicError(
+      "Invalid number of waypoint positions: " + std::to_string(path.get_num_joints()) + " != " +
+      std::to_string(driver.get_num_joints())
+    );
+  }
+  return path;
+}
+
+/**
+ * @brief Move all joints of a driver through a path of waypoints without stopping
+ *
+ * @param driver The configured driver with all joints in position mode
+ * @param waypoints Positions of all joints at every waypoint in rad for arm joints and m for the
+ * gripper joint
+ * @param times Times in s from now at which every waypoint should be reached, strictly
+ * increasing from above 0.0
+ * @param period Optional: command period in s, default 0.001s
+ *
+ * @details A C2-continuous cubic spline from rest at the current positions through all
+ * waypoints to rest is fitted once, see make_position_path(), then played back by commanding the
+ * evaluated positions with their velocities and accelerations as feedforward once per period.
+ *
+ * The playback runs on the calling thread, which is blocked for the whole path. The path is
+ * evaluated at the time each command is sent, so a period missed by this thread, e.g. when it is
+ * descheduled, makes the next command step ahead to where the path has moved on in the meantime.
+ *
+ * @note This function blocks until the last waypoint is reached
+ *
+ * @note The joints are assumed to be at rest and come to rest at the last waypoint
+ */
+inline void set_all_position_path(
+  TrossenArmDriver & driver,
+  const std::vector<std::vector<double>> & waypoints,
+  const std::vector<double> & times,
+  double period = 0.001
+)
+{
+  if (period <= 0.0) {
+    throw LogicError("Path period must be positive");
+  }
+  CubicSplinePath path = make_position_path(driver, waypoints, times);
+
+  std::vector<double> positions(driver.get_num_joints());
+  std::optional<std::vector<double>> velocities{std::vector<double>(driver.get_num_joints())};
+  std::optional<std::vector<double>> accelerations{std::vector<double>(driver.get_num_joints())};
+  const auto period_duration = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+    std::chrono::duration<double>(period)
+  );
+  const auto start_time = std::chrono::steady_clock::now();
+  auto next_time = start_time;
+  double time{0.0};
+  while (time < path.get_duration()) {
+    time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    path.evaluate(time, positions, velocities.value(), accelerations.value());
+    driver.set_all_positions(positions, 0.0, false, velocities, accelerations);
+    // Skip the missed periods instead of commanding in a burst to catch up
+    next_time = std::max(next_time + period_duration, std::chrono::steady_clock::now());
+    std::this_thread::sleep_until(next_time);
+  }
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_PATH_HPP_
@@ -0,0 +1,361 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_PUBLISHER_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_PUBLISHER_HPP_
+
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "libtrossen_arm/trossen_arm.hpp"
+#include "libtrossen_arm/trossen_arm_statistics.hpp"
+
+namespace trossen_arm
+{
+
+/**
+ * @brief Publisher of wait-free robot output snapshots
+ *
+ * @details A single publisher thread copies the robot output out of the driver once per
+ * publishing period and hands it over to the reader through a triple buffer. Readers never take
+ * the driver's mutexes, so a control loop that reads many fields per cycle contends with the
+ * daemon thread only once per period instead of once per getter call.
+ *
+ * The publisher thread itself takes the driver's mutexes for every copy, preempting the daemon
+ * thread as any getter call does. The publishing period should thus not be shorter than the
+ * daemon cycle, see DAEMON_PERIOD.
+ *
+ * The publisher also keeps statistics of the daemon cycles it observes, see
+ * get_cycle_statistics().
+ *
+ * @note The driver must be configured before constructing the publisher and must outlive it
+ *
+ * @note get_robot_output_snapshot() must be called from a single consumer thread
+ */
+class RobotOutputPublisher
+{
+public:
+  /**
+   * @brief Construct the publisher and start the publisher thread
+   *
+   * @param driver The configured driver to publish the robot output of
+   * @param period Optional: publishing period in s, default DAEMON_PERIOD
+   * @param overrun_threshold Optional: duration in s above which a daemon cycle is counted as an
+   * overrun, default 0.002s
+   */
+  explicit RobotOutputPublisher(
+    TrossenArmDriver & driver,
+    double period = DAEMON_PERIOD,
+    double overrun_threshold = 0.002
+  );
+
+  /// @brief Stop the publisher thread and destroy the publisher
+  ~RobotOutputPublisher();
+
+  RobotOutputPublisher(const RobotOutputPublisher &) = delete;
+  RobotOutputPublisher & operator=(const RobotOutputPublisher &) = delete;
+
+  /**
+   * @brief Get the latest published robot output
+   *
+   * @return Robot output, valid until the next call of this method
+   *
+   * @note This method is wait-free: it never blocks on the publisher or the daemon thread
+   *
+   * @note If the publisher thread failed, the exception it caught is rethrown here
+   */
+  const RobotOutput & get_robot_output_snapshot();
+
+  /**
+   * @brief Get the number of snapshots published since construction
+   *
+   * @return Number of published snapshots
+   */
+  uint64_t get_num_published() const;
+
+  /**
+   * @brief Get the duration of the latest daemon cycle
+   *
+   * @return Duration in s between the latest two published robot outputs divided by the number of
+   * cycles in between, measured by the arm controller's timestamps
+   */
+  double get_cycle_time() const;
+
+  /**
+   * @brief Get the statistics of the daemon cycles observed since construction or the last reset
+   *
+   * @return Cycle statistics
+   *
+   * @note The statistics are only as fine as the publishing period. With a period equal to the
+   * daemon cycle, the jitter between both threads leaves some cycles unobserved, so a shorter
+   * period refines the statistics at the cost of preempting the daemon thread more often
+   */
+  CycleStatistics get_cycle_statistics();
+
+  /// @brief Reset the statistics of the daemon cycles
+  void reset_cycle_statistics();
+
+private:
+  // Flag marking the middle buffer as not yet consumed
+  static constexpr uint8_t DIRTY_FLAG{0x4};
+
+  // Mask extracting the buffer index from the middle state
+  static constexpr uint8_t INDEX_MASK{0x3};
+
+  // Driver to publish the robot output of
+  TrossenArmDriver & driver_;
+
+  // Publishing period
+  std::chrono::steady_clock::duration period_{};
+
+  // Duration in s above which a daemon cycle is counted as an overrun
+  double overrun_threshold_{0.0};
+
+  // Triple buffer, each slot is owned by exactly one of back, middle, and front at any time
+  std::array<RobotOutput, 3> buffers_{};
+
+  // Index of the buffer being written by the publisher thread
+  uint8_t back_index_{0};
+
+  // Index of the buffer exchanged between the threads, combined with DIRTY_FLAG
+  std::atomic<uint8_t> middle_state_{1};
+
+  // Index of the buffer being read by the consumer
+  uint8_t front_index_{2};
+
+  // Number of published snapshots
+  std::atomic<uint64_t> num_published_{0};
+
+  // Duration of the latest daemon cycle in s
+  std::atomic<double> cycle_time_{0.0};
+
+  // Atomic flag for maintaining and stopping the publisher thread
+  std::atomic<bool> activated_{true};
+
+  // Atomic flag set once exception_ptr_ holds the publisher thread's exception
+  std::atomic<bool> failed_{false};
+
+  // Exception caught in the publisher thread
+  std::exception_ptr exception_ptr_{nullptr};
+
+  // Mutex for the statistics below
+  std::mutex mutex_statistics_{};
+
+  // Histogram of the daemon cycle durations measured by the arm controller's timestamps
+  LatencyHistogram cycle_time_histogram_{};
+
+  // Histogram of the host time between the arrivals of consecutive new robot outputs
+  LatencyHistogram update_interval_histogram_{};
+
+  // Histogram of the host time spent copying the robot output out of the driver
+  LatencyHistogram read_time_histogram_{};
+
+  // Number of daemon cycles covered by the statistics
+  uint64_t num_cycles_{0};
+
+  // Number of daemon cycles longer than the overrun threshold
+  uint64_t num_overruns_{0};
+
+  // Number of restarts of the robot output IDs
+  uint64_t num_id_resets_{0};
+
+  // Publisher thread
+  std::thread publisher_thread_{};
+
+  /**
+   * @brief Function to be executed by the publisher thread
+   *
+   * @details The publisher thread will repeatedly do the following:
+   *
+   * 1. Copy the robot output into the back buffer
+   *
+   * 2. Swap the back buffer with the middle buffer if it holds a new daemon cycle
+   *
+   * 3. Sleep until the next publishing period
+   *
+   * @param last_header Header of the robot output seeded in the front buffer
+   */
+  void publish(RobotOutput::Header last_header);
+};
+
+inline RobotOutputPublisher::RobotOutputPublisher(
+  TrossenArmDriver & driver,
+  double period,
+  double overrun_threshold
+)
+: driver_(driver),
+  period_(
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(period)
+    )
+  ),
+  overrun_threshold_(overrun_threshold)
+{
+  if (period <= 0.0) {
+    throw LogicError("Publishing period must be positive");
+  }
+  if (overrun_threshold <= 0.0) {
+    throw LogicError("Overrun threshold must be positive");
+  }
+  // Seed the front buffer so the first snapshot is valid even before the thread publishes
+  buffers_[front_index_] = driver_.get_robot_output();
+  publisher_thread_ = std::thread(
+    &RobotOutputPublisher::publish,
+    this,
+    buffers_[front_index_].header
+  );
+}
+
+inline RobotOutputPublisher::~RobotOutputPublisher()
+{
+  activated_.store(false, std::memory_order_relaxed);
+  if (publisher_thread_.joinable()) {
+    publisher_thread_.join();
+  }
+}
+
+inline const RobotOutput & RobotOutputPublisher::get_robot_output_snapshot()
+{
+  if (failed_.load(std::memory_order_acquire)) {
+    std::rethrow_exception(exception_ptr_);
+  }
+  if (middle_state_.load(std::memory_order_relaxed) & DIRTY_FLAG) {
+    front_index_ = middle_state_.exchange(front_index_, std::memory_order_acq_rel) & INDEX_MASK;
+  }
+  return buffers_[front_index_];
+}
+
+inline uint64_t RobotOutputPublisher::get_num_published() const
+{
+  return num_published_.load(std::memory_order_relaxed);
+}
+
+inline double RobotOutputPublisher::get_cycle_time() const
+{
+  return cycle_time_.load(std::memory_order_relaxed);
+}
+
+inline CycleStatistics RobotOutputPublisher::get_cycle_statistics()
+{
+  std::lock_guard<std::mutex> lock(mutex_statistics_);
+  CycleStatistics cycle_statistics{};
+  cycle_statistics.cycle_time = cycle_time_histogram_.get_summary();
+  cycle_statistics.update_interval = update_interval_histogram_.get_summary();
+  cycle_statistics.read_time = read_time_histogram_.get_summary();
+  cycle_statistics.num_cycles = num_cycles_;
+  cycle_statistics.num_overruns = num_overruns_;
+  cycle_statistics.num_id_resets = num_id_resets_;
+  return cycle_statistics;
+}
+
+inline void RobotOutputPublisher::reset_cycle_statistics()
+{
+  std::lock_guard<std::mutex> lock(mutex_statistics_);
+  cycle_time_histogram_.reset();
+  update_interval_histogram_.reset();
+  read_time_histogram_.reset();
+  num_cycles_ = 0;
+  num_overruns_ = 0;
+  num_id_resets_ = 0;
+}
+
+inline void RobotOutputPublisher::publish(RobotOutput::Header last_header)
+{
+  auto next_time = std::chrono::steady_clock::now();
+  auto last_arrival_time = next_time;
+  // Header of the latest stale robot output, if the previous one read was stale
+  std::optional<RobotOutput::Header> stale_header{};
+  try {
+    while (activated_.load(std::memory_order_relaxed)) {
+      const auto read_start_time = std::chrono::steady_clock::now();
+      driver_.get_robot_output(buffers_[back_index_]);
+      const auto read_end_time = std::chrono::steady_clock::now();
+      const RobotOutput::Header header = buffers_[back_index_].header;
+      // Compare the IDs in serial number arithmetic so that they may wrap around
+      bool is_stale = static_cast<int32_t>(header.id - last_header.id) < 0;
+      bool is_id_reset = false;
+      if (is_stale && stale_header && static_cast<int32_t>(header.id - stale_header->id) > 0) {
+        // Stale robot outputs that keep advancing come from a reconfigured arm controller
+        // restarting its IDs, so follow them from the previous one
+        last_header = stale_header.value();
+        is_stale = false;
+        is_id_reset = true;
+      }
+      stale_header = is_stale ? std::optional<RobotOutput::Header>{header} : std::nullopt;
+      const bool is_new_cycle = static_cast<int32_t>(header.id - last_header.id) > 0;
+      const auto elapsed = static_cast<int64_t>(header.timestamp - last_header.timestamp);
+      const auto num_cycles = static_cast<uint32_t>(header.id - last_header.id);
+      const double cycle_time = is_new_cycle ? elapsed * 1e-6 / num_cycles : 0.0;
+      {
+        std::lock_guard<std::mutex> lock(mutex_statistics_);
+        read_time_histogram_.record(
+          std::chrono::duration<double>(read_end_time - read_start_time).count()
+        );
+        if (is_id_reset) {
+          ++num_id_resets_;
+        }
+        if (is_new_cycle) {
+          const double update_interval =
+            std::chrono::duration<double>(read_end_time - last_arrival_time).count();
+          cycle_time_histogram_.record(cycle_time, num_cycles);
+          update_interval_histogram_.record(update_interval);
+          num_cycles_ += num_cycles;
+          if (cycle_time > overrun_threshold_) {
+            num_overruns_ += num_cycles;
+          }
+        }
+      }
+      if (is_new_cycle) {
+        cycle_time_.store(cycle_time, std::memory_order_relaxed);
+        last_header = header;
+        last_arrival_time = read_end_time;
+        back_index_ =
+          middle_state_.exchange(back_index_ | DIRTY_FLAG, std::memory_order_acq_rel) & INDEX_MASK;
+        num_published_.fetch_add(1, std::memory_order_relaxed);
+      }
+      // Skip the missed periods instead of publishing in a burst to catch up
+      next_time = std::max(next_time + period_, std::chrono::steady_clock::now());
+      std::this_thread::sleep_until(next_time);
+    }
+  } catch (...) {
+    exception_ptr_ = std::current_exception();
+    failed_.store(true, std::memory_order_release);
+  }
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_PUBLISHER_HPP_
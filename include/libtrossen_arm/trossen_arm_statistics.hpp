@@ -0,0 +1,240 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_STATISTICS_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_STATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace trossen_arm
+{
+
+/// @brief Summary of a latency distribution
+struct LatencySummary
+{
+  /// @brief Number of recorded samples
+  uint64_t count{0};
+  /// @brief Minimum in s
+  double min{0.0};
+  /// @brief Mean in s
+  double mean{0.0};
+  /// @brief Median in s
+  double p50{0.0};
+  /// @brief 99th percentile in s
+  double p99{0.0};
+  /// @brief 99.9th percentile in s
+  double p999{0.0};
+  /// @brief Maximum in s
+  double max{0.0};
+};
+
+/**
+ * @brief Latency histogram with logarithmic buckets of bounded relative error
+ *
+ * @details Samples are recorded in nanoseconds. Values below 2 * SUB_BUCKET_COUNT ns get one
+ * bucket each, and every power-of-two range above is split into SUB_BUCKET_COUNT linear buckets,
+ * as in HDR histograms. The relative error of any reported percentile is thus below
+ * 1 / SUB_BUCKET_COUNT. The buckets are stored inline, so recording never allocates.
+ */
+class LatencyHistogram
+{
+public:
+  /// @brief Number of bits resolved within every power-of-two range
+  static constexpr uint32_t SUB_BUCKET_BITS{6};
+
+  /// @brief Number of linear buckets in every power-of-two range
+  static constexpr uint64_t SUB_BUCKET_COUNT{uint64_t{1} << SUB_BUCKET_BITS};
+
+  /// @brief Largest power of two of the recordable range in ns, larger samples are clamped
+  static constexpr uint32_t MAX_MAGNITUDE{40};
+
+  /**
+   * @brief Record a sample
+   *
+   * @param value Sample in s, negative values are recorded as zero
+   * @param count Optional: number of times to record the sample, default 1
+   */
+  void record(double value, uint64_t count = 1)
+  {
+    if (count == 0) {
+      return;
+    }
+    const double value_ns = std::max(value, 0.0) * 1e9;
+    const uint64_t value_clamped =
+      value_ns >= static_cast<double>(MAX_VALUE) ? MAX_VALUE : static_cast<uint64_t>(value_ns);
+    counts_[get_bucket_index(value_clamped)] += count;
+    count_ += count;
+    sum_ += value_clamped * 1e-9 * count;
+    min_ = std::min(min_, value_clamped);
+    max_ = std::max(max_, value_clamped);
+  }
+
+  /**
+   * @brief Get the value at a given percentile
+   *
+   * @param percentile Percentile in [0.0, 100.0]
+   * @return Highest value equivalent to the bucket holding the percentile in s, 0.0 if empty
+   */
+  double get_percentile(double percentile) const
+  {
+    if (count_ == 0) {
+      return 0.0;
+    }
+    // Scale before dividing so that ranks at integer counts stay exact, e.g. 99.9 of 1000
+    const double rank = std::clamp(percentile, 0.0, 100.0) * static_cast<double>(count_) / 100.0;
+    const auto target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(rank)));
+    uint64_t cumulative{0};
+    for (size_t index = 0; index < NUM_BUCKETS; ++index) {
+      cumulative += counts_[index];
+      if (cumulative >= target) {
+        return std::clamp(get_bucket_upper_value(index), min_, max_) * 1e-9;
+      }
+    }
+    return max_ * 1e-9;
+  }
+
+  /**
+   * @brief Get the summary of the recorded samples
+   *
+   * @return Count, minimum, mean, percentiles, and maximum
+   */
+  LatencySummary get_summary() const
+  {
+    LatencySummary summary{};
+    summary.count = count_;
+    if (count_ == 0) {
+      return summary;
+    }
+    summary.min = min_ * 1e-9;
+    summary.mean = sum_ / static_cast<double>(count_);
+    summary.p50 = get_percentile(50.0);
+    summary.p99 = get_percentile(99.0);
+    summary.p999 = get_percentile(99.9);
+    summary.max = max_ * 1e-9;
+    return summary;
+  }
+
+  /// @brief Clear all recorded samples
+  void reset()
+  {
+    counts_.fill(0);
+    count_ = 0;
+    sum_ = 0.0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+  }
+
+private:
+  // Largest recordable value in ns
+  static constexpr uint64_t MAX_VALUE{(uint64_t{1} << MAX_MAGNITUDE) - 1};
+
+  // Number of buckets covering [0, MAX_VALUE]
+  static constexpr size_t NUM_BUCKETS{
+    SUB_BUCKET_COUNT * (MAX_MAGNITUDE - SUB_BUCKET_BITS - 1) + 2 * SUB_BUCKET_COUNT
+  };
+
+  // Sample counts of every bucket
+  std::array<uint64_t, NUM_BUCKETS> counts_{};
+
+  // Total number of samples
+  uint64_t count_{0};
+
+  // Sum of the samples in s
+  double sum_{0.0};
+
+  // Minimum sample in ns
+  uint64_t min_{std::numeric_limits<uint64_t>::max()};
+
+  // Maximum sample in ns
+  uint64_t max_{0};
+
+  /**
+   * @brief Get the index of the bucket holding a value
+   *
+   * @param value Value in ns
+   * @return Bucket index
+   */
+  static size_t get_bucket_index(uint64_t value)
+  {
+    uint64_t shift{0};
+    while ((value >> shift) >= 2 * SUB_BUCKET_COUNT) {
+      ++shift;
+    }
+    return static_cast<size_t>(SUB_BUCKET_COUNT * shift + (value >> shift));
+  }
+
+  /**
+   * @brief Get the highest value held by a bucket
+   *
+   * @param index Bucket index
+   * @return Highest value in ns
+   */
+  static uint64_t get_bucket_upper_value(size_t index)
+  {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+      return index;
+    }
+    const uint64_t shift = index / SUB_BUCKET_COUNT - 1;
+    const uint64_t mantissa = index - SUB_BUCKET_COUNT * shift;
+    return ((mantissa + 1) << shift) - 1;
+  }
+};
+
+/**
+ * @brief Statistics of the daemon cycles observed through the robot outputs
+ *
+ * @details The robot outputs are observed by polling the driver, which only keeps the latest one.
+ * A robot output read again is not counted, and the cycles between two observed robot outputs are
+ * covered by the cycle time measured across them.
+ */
+struct CycleStatistics
+{
+  /// @brief Duration of the daemon cycles measured by the arm controller's timestamps
+  LatencySummary cycle_time{};
+  /// @brief Host time between the arrivals of consecutive new robot outputs
+  LatencySummary update_interval{};
+  /// @brief Host time spent copying the robot output out of the driver, mutex waiting included
+  LatencySummary read_time{};
+  /// @brief Number of daemon cycles covered by the statistics
+  uint64_t num_cycles{0};
+  /// @brief Number of daemon cycles longer than the overrun threshold
+  uint64_t num_overruns{0};
+  /// @brief Number of times the robot output IDs restarted from a lower one, e.g. after the arm
+  /// controller was reconfigured, and were followed from there
+  uint64_t num_id_resets{0};
+};
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_STATISTICS_HPP_
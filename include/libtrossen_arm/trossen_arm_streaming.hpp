@@ -0,0 +1,725 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_STREAMING_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_STREAMING_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm.hpp"
+#include "libtrossen_arm/trossen_arm_collision.hpp"
+#include "libtrossen_arm/trossen_arm_interpolation.hpp"
+
+namespace trossen_arm
+{
+
+/**
+ * @brief Bounded lock-free single-producer single-consumer queue
+ *
+ * @details The slots are allocated once at construction. try_push() must only be called from one
+ * producer thread and try_pop() from one consumer thread, neither ever blocks or allocates.
+ *
+ * @tparam T Type of the elements, copied in and out of the slots
+ */
+template<typename T>
+class SpscQueue
+{
+public:
+  /**
+   * @brief Construct the queue
+   *
+   * @param capacity Maximum number of elements, rounded up to a power of two
+   */
+  explicit SpscQueue(size_t capacity)
+  {
+    size_t size{1};
+    while (size < capacity) {
+      size <<= 1;
+    }
+    slots_.resize(size);
+    mask_ = size - 1;
+  }
+
+  /**
+   * @brief Append an element if the queue is not full
+   *
+   * @param value Element to append
+   * @return true if appended, false if the queue is full
+   */
+  bool try_push(const T & value)
+  {
+    const size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) > mask_) {
+      return false;
+    }
+    slots_[tail & mask_] = value;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest element if the queue is not empty
+   *
+   * @param value Element to copy the oldest element into
+   * @return true if removed, false if the queue is empty
+   */
+  bool try_pop(T & value)
+  {
+    const size_t head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    value = slots_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Get the number of elements in the queue
+   *
+   * @return Number of elements, exact only when called from the producer or the consumer thread
+   */
+  size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Get the capacity of the queue
+   *
+   * @return Maximum number of elements
+   */
+  size_t capacity() const
+  {
+    return slots_.size();
+  }
+
+private:
+  // Slots of the ring buffer
+  std::vector<T> slots_{};
+
+  // Mask wrapping the indices into the ring buffer
+  size_t mask_{0};
+
+  // Index of the next element to pop, only written by the consumer
+  alignas(64) std::atomic<size_t> head_{0};
+
+  // Index of the next element to push, only written by the producer
+  alignas(64) std::atomic<size_t> tail_{0};
+};
+
+/// @brief Waypoint of a streamed joint trajectory
+struct StreamWaypoint
+{
+  /// @brief Positions of all joints in rad for arm joints and m for the gripper joint
+  FixedRobotOutput::JointArray positions{};
+
+  /// @brief Velocities of all joints in rad/s for arm joints and m/s for the gripper joint
+  FixedRobotOutput::JointArray velocities{};
+
+  /// @brief Whether the velocities are specified, else they are estimated
+  bool has_velocities{false};
+
+  /// @brief Duration in s of the segment from the previous waypoint to this one
+  double duration{0.0};
+
+  /// @brief Number of collision faults cleared before the waypoint was appended
+  uint64_t epoch{0};
+};
+
+/**
+ * @brief Player of queued joint position waypoints
+ *
+ * @details The player holds the segment logic of TrajectoryStreamer without its thread or
+ * driver, so that it can be stepped with any time step: every step() starts the next queued
+ * segments as needed and evaluates the command at the elapsed time, which advance() moves on.
+ * See TrajectoryStreamer for the splicing of the waypoints, the braking on underruns, and the
+ * holding on collisions.
+ */
+class TrajectoryPlayer
+{
+public:
+  /// @brief Events of a step
+  struct Events
+  {
+    /// @brief Whether a segment ended with no waypoint queued
+    bool underrun{false};
+    /// @brief Whether the evaluated command was in collision and replaced by the held positions
+    bool collision{false};
+  };
+
+  /**
+   * @brief Construct the player holding at rest
+   *
+   * @param initial_positions Positions of all joints to start the first segment from in rad for
+   * arm joints and m for the gripper joint
+   * @param collision_checker Optional: checker of the arm joints' commands, none by default
+   */
+  explicit TrajectoryPlayer(
+    const std::vector<double> & initial_positions,
+    const std::optional<CollisionChecker> & collision_checker = std::nullopt
+  );
+
+  /**
+   * @brief Start the next queued segments if needed and evaluate the command
+   *
+   * @param queue Queue of the waypoints not yet started
+   * @param epoch Number of collision faults cleared so far, waypoints stamped with it or an older
+   * one are discarded after a collision
+   * @param positions Commanded positions
+   * @param velocities Commanded velocities
+   * @param accelerations Commanded accelerations
+   * @return Events of the step
+   */
+  Events step(
+    SpscQueue<StreamWaypoint> & queue,
+    uint64_t epoch,
+    BatchQuinticHermiteInterpolator::Channels & positions,
+    BatchQuinticHermiteInterpolator::Channels & velocities,
+    BatchQuinticHermiteInterpolator::Channels & accelerations
+  );
+
+  /**
+   * @brief Advance the elapsed time
+   *
+   * @param time_step Time step in s
+   */
+  void advance(double time_step);
+
+  /**
+   * @brief Get the number of joints
+   *
+   * @return Number of joints
+   */
+  size_t get_num_joints() const;
+
+private:
+  // Number of joints
+  size_t num_joints_{0};
+
+  // Checker of the arm joints' commands
+  std::optional<CollisionChecker> collision_checker_{};
+
+  // Current segment from (start_positions_, start_velocities_) to (end_positions_,
+  // end_velocities_)
+  FixedRobotOutput::JointArray start_positions_{};
+  FixedRobotOutput::JointArray start_velocities_{};
+  FixedRobotOutput::JointArray end_positions_{};
+  FixedRobotOutput::JointArray end_velocities_{};
+
+  // Duration of the current segment in s
+  double duration_{0.0};
+
+  // Time elapsed since the start of the current segment in s
+  double elapsed_{0.0};
+
+  // Whether the positions are held at rest until the next waypoint
+  bool holding_{true};
+
+  // Whether the current segment brakes to rest after an underrun
+  bool braking_{false};
+
+  // Interpolator of the current segment
+  BatchQuinticHermiteInterpolator interpolator_{};
+
+  // Last positions commanded without collision
+  FixedRobotOutput::JointArray safe_positions_{};
+
+  // Waypoints stamped with an older epoch were appended before the last collision and are
+  // discarded
+  uint64_t min_epoch_{0};
+
+  /**
+   * @brief Hold positions at rest
+   *
+   * @param positions Positions to hold
+   */
+  void hold(FixedRobotOutput::JointArray positions);
+};
+
+inline TrajectoryPlayer::TrajectoryPlayer(
+  const std::vector<double> & initial_positions,
+  const std::optional<CollisionChecker> & collision_checker
+)
+: num_joints_(initial_positions.size()),
+  collision_checker_(collision_checker)
+{
+  if (num_joints_ > MAX_NUM_JOINTS) {
+    throw LogicError(
+      "Number of joints exceeds the maximum: " + std::to_string(num_joints_) + " > " +
+      std::to_string(MAX_NUM_JOINTS)
+    );
+  }
+  if (collision_checker_ && num_joints_ < CollisionChecker::NUM_ARM_JOINTS) {
+    throw LogicError(
+      "Number of joints is too small for the collision checker: " +
+      std::to_string(num_joints_) + " < " + std::to_string(CollisionChecker::NUM_ARM_JOINTS)
+    );
+  }
+  FixedRobotOutput::JointArray positions{};
+  std::copy(initial_positions.begin(), initial_positions.end(), positions.begin());
+  safe_positions_ = positions;
+  hold(positions);
+}
+
+inline TrajectoryPlayer::Events TrajectoryPlayer::step(
+  SpscQueue<StreamWaypoint> & queue,
+  uint64_t epoch,
+  BatchQuinticHermiteInterpolator::Channels & positions,
+  BatchQuinticHermiteInterpolator::Channels & velocities,
+  BatchQuinticHermiteInterpolator::Channels & accelerations
+)
+{
+  const FixedRobotOutput::JointArray zeros{};
+  Events events;
+  StreamWaypoint waypoint;
+  // Start the next segments until the elapsed time falls within one
+  while (elapsed_ >= duration_) {
+    const bool popped = queue.try_pop(waypoint);
+    if (popped && waypoint.epoch < min_epoch_) {
+      continue;
+    }
+    if (!popped) {
+      if (!holding_ && !braking_) {
+        events.underrun = true;
+        const bool moving = std::any_of(
+          end_velocities_.begin(),
+          end_velocities_.begin() + num_joints_,
+          [](double velocity) {return velocity != 0.0;}
+        );
+        if (moving) {
+          // Decelerate with the smoothstep velocity profile, whose quintic reaches rest with zero
+          // acceleration after covering half the duration times the initial velocity
+          braking_ = true;
+          elapsed_ -= duration_;
+          start_positions_ = end_positions_;
+          start_velocities_ = end_velocities_;
+          for (size_t i = 0; i < num_joints_; ++i) {
+            end_positions_[i] = start_positions_[i] + 0.5 * start_velocities_[i] * duration_;
+          }
+          end_velocities_.fill(0.0);
+          interpolator_.compute_coefficients(
+            num_joints_,
+            start_positions_.data(),
+            start_velocities_.data(),
+            zeros.data(),
+            end_positions_.data(),
+            zeros.data(),
+            zeros.data(),
+            duration_
+          );
+          continue;
+        }
+      }
+      hold(end_positions_);
+      break;
+    }
+    elapsed_ = holding_ ? 0.0 : elapsed_ - duration_;
+    start_positions_ = end_positions_;
+    start_velocities_ = holding_ ? FixedRobotOutput::JointArray{} : end_velocities_;
+    end_positions_ = waypoint.positions;
+    duration_ = waypoint.duration;
+    for (size_t i = 0; i < num_joints_; ++i) {
+      end_velocities_[i] = waypoint.has_velocities ?
+        waypoint.velocities[i] : (end_positions_[i] - start_positions_[i]) / duration_;
+    }
+    holding_ = false;
+    braking_ = false;
+    interpolator_.compute_coefficients(
+      num_joints_,
+      start_positions_.data(),
+      start_velocities_.data(),
+      zeros.data(),
+      end_positions_.data(),
+      end_velocities_.data(),
+      zeros.data(),
+      duration_
+    );
+  }
+
+  interpolator_.evaluate(elapsed_, positions, velocities, accelerations);
+  if (collision_checker_) {
+    ArmKinematics::JointPositions arm_positions;
+    std::copy_n(positions.begin(), arm_positions.size(), arm_positions.begin());
+    if (collision_checker_->check(arm_positions).is_safe()) {
+      std::copy_n(positions.begin(), num_joints_, safe_positions_.begin());
+    } else {
+      // Discard the queued waypoints and hold the last safe positions
+      events.collision = true;
+      min_epoch_ = epoch + 1;
+      hold(safe_positions_);
+      interpolator_.evaluate(0.0, positions, velocities, accelerations);
+    }
+  }
+  return events;
+}
+
+inline void TrajectoryPlayer::advance(double time_step)
+{
+  elapsed_ += time_step;
+}
+
+inline size_t TrajectoryPlayer::get_num_joints() const
+{
+  return num_joints_;
+}
+
+inline void TrajectoryPlayer::hold(FixedRobotOutput::JointArray positions)
+{
+  const FixedRobotOutput::JointArray zeros{};
+  start_positions_ = positions;
+  start_velocities_.fill(0.0);
+  end_positions_ = positions;
+  end_velocities_.fill(0.0);
+  elapsed_ = 0.0;
+  duration_ = 0.0;
+  holding_ = true;
+  braking_ = false;
+  interpolator_.compute_coefficients(
+    num_joints_,
+    start_positions_.data(),
+    zeros.data(),
+    zeros.data(),
+    end_positions_.data(),
+    zeros.data(),
+    zeros.data(),
+    0.0
+  );
+}
+
+/**
+ * @brief Streamer of joint position waypoints
+ *
+ * @details Waypoints are appended without blocking to a lock-free queue consumed by a single
+ * streamer thread. The streamer thread splices consecutive waypoints with quintic Hermite segments
+ * of zero acceleration at the waypoints, so the commanded positions, velocities, and accelerations
+ * are continuous across waypoints, and commands the evaluated positions with their velocities and
+ * accelerations as feedforward once per period.
+ *
+ * Waypoint velocities that are not specified are estimated as the mean velocity of the segment
+ * ending at the waypoint.
+ *
+ * If the queue runs dry when a segment ends, an underrun is counted. If the joints are still
+ * moving, a braking segment of the same duration decelerates them to rest with continuous
+ * velocities and accelerations, ending half the duration times the velocity past the last
+ * waypoint. The positions are then held at rest until the next waypoint arrives, which starts
+ * from rest.
+ *
+ * If a collision checker is given, every evaluated command is checked before being sent. A
+ * command in collision is rejected, a collision is counted, and the streamer holds the last
+ * collision-free command with a collision fault latched. While the fault is latched, the queued
+ * waypoints are discarded and append() refuses new ones, until clear_collision_fault() is called.
+ * The next waypoint appended after that starts from the held positions.
+ *
+ * @warning Only the commands of the streamer are checked, commands sent to the driver directly,
+ * e.g. with set_all_positions(), are not
+ *
+ * @note The driver must be configured with all joints in position mode before constructing the
+ * streamer and must outlive it
+ *
+ * @note append() must be called from a single producer thread
+ *
+ * @see TrajectoryPlayer for the segment logic without the thread and driver
+ */
+class TrajectoryStreamer
+{
+public:
+  /**
+   * @brief Construct the streamer and start the streamer thread
+   *
+   * @param driver The configured driver to stream the waypoints to
+   * @param capacity Optional: maximum number of queued waypoints, default 256
+   * @param period Optional: command period in s, default 0.001s
+   * @param collision_checker Optional: checker of the arm joints' commands, none by default
+   */
+  explicit TrajectoryStreamer(
+    TrossenArmDriver & driver,
+    size_t capacity = 256,
+    double period = 0.001,
+    const std::optional<CollisionChecker> & collision_checker = std::nullopt
+  );
+
+  /// @brief Stop the streamer thread and destroy the streamer
+  ~TrajectoryStreamer();
+
+  TrajectoryStreamer(const TrajectoryStreamer &) = delete;
+  TrajectoryStreamer & operator=(const TrajectoryStreamer &) = delete;
+
+  /**
+   * @brief Append a waypoint of all joints without blocking
+   *
+   * @param positions Positions in rad for arm joints and m for the gripper joint
+   * @param duration Duration in s of the segment from the previous waypoint to this one
+   * @param velocities Optional: velocities in rad/s for arm joints and m/s for the gripper joint,
+   * estimated if not specified
+   * @return true if appended, false if the queue is full or a collision fault is latched
+   *
+   * @note If the streamer thread failed, the exception it caught is rethrown here
+   */
+  bool append(
+    const std::vector<double> & positions,
+    double duration,
+    const std::optional<std::vector<double>> & velocities = std::nullopt
+  );
+
+  /**
+   * @brief Get the number of queued waypoints
+   *
+   * @return Number of waypoints not yet started
+   */
+  size_t get_queue_depth() const;
+
+  /**
+   * @brief Get the number of underruns since construction
+   *
+   * @return Number of times a segment ended with no waypoint queued
+   */
+  uint64_t get_num_underruns() const;
+
+  /**
+   * @brief Get the number of rejected commands since construction
+   *
+   * @return Number of commands found in collision by the collision checker
+   */
+  uint64_t get_num_collisions() const;
+
+  /**
+   * @brief Get whether a collision fault is latched
+   *
+   * @return true if a command was rejected by the collision checker since construction or the last
+   * call to clear_collision_fault(), false otherwise
+   */
+  bool get_collision_fault() const;
+
+  /**
+   * @brief Clear the latched collision fault
+   *
+   * @note Waypoints appended before the fault was latched are discarded even if still queued
+   */
+  void clear_collision_fault();
+
+private:
+  // Driver to stream the waypoints to
+  TrossenArmDriver & driver_;
+
+  // Player of the waypoints, only used by the streamer thread once started
+  TrajectoryPlayer player_;
+
+  // Number of joints
+  size_t num_joints_{0};
+
+  // Command period
+  std::chrono::steady_clock::duration period_{};
+
+  // Queue of the waypoints not yet started
+  SpscQueue<StreamWaypoint> queue_;
+
+  // Number of underruns
+  std::atomic<uint64_t> num_underruns_{0};
+
+  // Number of commands rejected by the collision checker
+  std::atomic<uint64_t> num_collisions_{0};
+
+  // Atomic flag set by the streamer thread on a collision and reset by clear_collision_fault()
+  std::atomic<bool> collision_fault_{false};
+
+  // Number of collision faults cleared, stamped on the appended waypoints
+  std::atomic<uint64_t> collision_epoch_{0};
+
+  // Atomic flag for maintaining and stopping the streamer thread
+  std::atomic<bool> activated_{true};
+
+  // Atomic flag set once exception_ptr_ holds the streamer thread's exception
+  std::atomic<bool> failed_{false};
+
+  // Exception caught in the streamer thread
+  std::exception_ptr exception_ptr_{nullptr};
+
+  // Streamer thread
+  std::thread streamer_thread_{};
+
+  /**
+   * @brief Function to be executed by the streamer thread
+   *
+   * @details The streamer thread will repeatedly do the following:
+   *
+   * 1. Step the player, counting an underrun or latching a collision fault if it reports one
+   *
+   * 2. Command the positions with feedforward velocities and accelerations
+   *
+   * 3. Sleep until the next period and advance the player by the time slept
+   */
+  void run();
+};
+
+inline TrajectoryStreamer::TrajectoryStreamer(
+  TrossenArmDriver & driver,
+  size_t capacity,
+  double period,
+  const std::optional<CollisionChecker> & collision_checker
+)
+: driver_(driver),
+  player_(driver.get_all_positions(), collision_checker),
+  num_joints_(player_.get_num_joints()),
+  period_(
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(period)
+    )
+  ),
+  queue_(capacity)
+{
+  if (period <= 0.0) {
+    throw LogicError("Streaming period must be positive");
+  }
+  streamer_thread_ = std::thread(&TrajectoryStreamer::run, this);
+}
+
+inline TrajectoryStreamer::~TrajectoryStreamer()
+{
+  activated_.store(false, std::memory_order_relaxed);
+  if (streamer_thread_.joinable()) {
+    streamer_thread_.join();
+  }
+}
+
+inline bool TrajectoryStreamer::append(
+  const std::vector<double> & positions,
+  double duration,
+  const std::optional<std::vector<double>> & velocities
+)
+{
+  if (failed_.load(std::memory_order_acquire)) {
+    std::rethrow_exception(exception_ptr_);
+  }
+  if (positions.size() != num_joints_ || (velocities && velocities->size() != num_joints_)) {
+    throw LogicError(
+      "Invalid waypoint size: expected " + std::to_string(num_joints_) + " joints"
+    );
+  }
+  if (duration <= 0.0) {
+    throw LogicError("Waypoint duration must be positive");
+  }
+  if (collision_fault_.load(std::memory_order_acquire)) {
+    return false;
+  }
+  StreamWaypoint waypoint;
+  std::copy(positions.begin(), positions.end(), waypoint.positions.begin());
+  if (velocities) {
+    std::copy(velocities->begin(), velocities->end(), waypoint.velocities.begin());
+    waypoint.has_velocities = true;
+  }
+  waypoint.duration = duration;
+  waypoint.epoch = collision_epoch_.load(std::memory_order_acquire);
+  return queue_.try_push(waypoint);
+}
+
+inline size_t TrajectoryStreamer::get_queue_depth() const
+{
+  return queue_.size();
+}
+
+inline uint64_t TrajectoryStreamer::get_num_underruns() const
+{
+  return num_underruns_.load(std::memory_order_relaxed);
+}
+
+inline uint64_t TrajectoryStreamer::get_num_collisions() const
+{
+  return num_collisions_.load(std::memory_order_relaxed);
+}
+
+inline bool TrajectoryStreamer::get_collision_fault() const
+{
+  return collision_fault_.load(std::memory_order_acquire);
+}
+
+inline void TrajectoryStreamer::clear_collision_fault()
+{
+  if (collision_fault_.load(std::memory_order_acquire)) {
+    collision_epoch_.fetch_add(1, std::memory_order_acq_rel);
+    collision_fault_.store(false, std::memory_order_release);
+  }
+}
+
+inline void TrajectoryStreamer::run()
+{
+  BatchQuinticHermiteInterpolator::Channels positions{};
+  BatchQuinticHermiteInterpolator::Channels velocities{};
+  BatchQuinticHermiteInterpolator::Channels accelerations{};
+  std::vector<double> goal_positions(num_joints_);
+  std::optional<std::vector<double>> goal_velocities{std::vector<double>(num_joints_)};
+  std::optional<std::vector<double>> goal_accelerations{std::vector<double>(num_joints_)};
+
+  auto next_time = std::chrono::steady_clock::now();
+  try {
+    while (activated_.load(std::memory_order_relaxed)) {
+      const TrajectoryPlayer::Events events = player_.step(
+        queue_,
+        collision_epoch_.load(std::memory_order_acquire),
+        positions,
+        velocities,
+        accelerations
+      );
+      if (events.underrun) {
+        num_underruns_.fetch_add(1, std::memory_order_relaxed);
+      }
+      if (events.collision) {
+        num_collisions_.fetch_add(1, std::memory_order_relaxed);
+        collision_fault_.store(true, std::memory_order_release);
+      }
+      std::copy_n(positions.begin(), num_joints_, goal_positions.begin());
+      std::copy_n(velocities.begin(), num_joints_, goal_velocities->begin());
+      std::copy_n(accelerations.begin(), num_joints_, goal_accelerations->begin());
+      driver_.set_all_positions(goal_positions, 0.0, false, goal_velocities, goal_accelerations);
+
+      // Skip the missed periods instead of commanding in a burst to catch up
+      const auto last_time = next_time;
+      next_time = std::max(next_time + period_, std::chrono::steady_clock::now());
+      player_.advance(std::chrono::duration<double>(next_time - last_time).count());
+      std::this_thread::sleep_until(next_time);
+    }
+  } catch (...) {
+    exception_ptr_ = std::current_exception();
+    failed_.store(true, std::memory_order_release);
+  }
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_STREAMING_HPP_
@@ -0,0 +1,353 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef LIBTROSSEN_ARM__TROSSEN_ARM_TELEOPERATION_HPP_
+#define LIBTROSSEN_ARM__TROSSEN_ARM_TELEOPERATION_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm.hpp"
+
+namespace trossen_arm
+{
+
+/// @brief Configuration of a leader/follower teleoperation
+struct TeleoperationConfiguration
+{
+  /// @brief Index of the leader joint driving every follower joint, empty for one-to-one
+  std::vector<size_t> joint_mapping{};
+
+  /// @brief Scale from the leader joint to every follower joint, empty for 1.0
+  std::vector<double> joint_scales{};
+
+  /// @brief Offset added to every scaled follower position in rad or m, empty for 0.0
+  std::vector<double> joint_offsets{};
+
+  /// @brief Gain from the follower external efforts to the leader external efforts
+  double force_feedback_gain{0.1};
+
+  /// @brief Whether to feed the leader velocities forward to the follower
+  bool feedforward_velocities{true};
+
+  /// @brief Polling period of the leader robot output in s
+  /// @note Every poll preempts the leader's daemon thread, so it should not be shorter than
+  /// DAEMON_PERIOD
+  double period{DAEMON_PERIOD};
+};
+
+/**
+ * @brief Leader/follower teleoperation with force feedback
+ *
+ * @details A single teleoperation thread polls the leader's robot output. As soon as a new daemon
+ * cycle arrives, it commands the follower joint positions
+ *
+ * follower_position[i] = joint_scales[i] * leader_position[joint_mapping[i]] + joint_offsets[i]
+ *
+ * with the scaled leader velocities as feedforward, then feeds the follower external efforts back
+ * to the leader
+ *
+ * leader_external_effort[joint_mapping[i]] = -force_feedback_gain * joint_scales[i] *
+ * follower_external_effort[i]
+ *
+ * All buffers are allocated at construction, so no allocation happens while teleoperating and the
+ * latency from a leader update to the follower command is bounded by the polling period.
+ *
+ * @note The drivers must be configured, the leader with all joints in external effort mode and
+ * the follower with all joints in position mode, before constructing the teleoperation, and must
+ * outlive it
+ *
+ * @note If the teleoperation thread fails, it stops updating both arms, so get_num_updates()
+ * should be polled to notice it
+ *
+ * @note The leader external efforts are reset to zero when the teleoperation is destroyed
+ */
+class Teleoperation
+{
+public:
+  /**
+   * @brief Construct the teleoperation and start the teleoperation thread
+   *
+   * @param driver_leader The configured driver of the leader
+   * @param driver_follower The configured driver of the follower
+   * @param configuration Optional: teleoperation configuration, default one-to-one with a force
+   * feedback gain of 0.1
+   */
+  Teleoperation(
+    TrossenArmDriver & driver_leader,
+    TrossenArmDriver & driver_follower,
+    const TeleoperationConfiguration & configuration = TeleoperationConfiguration{}
+  );
+
+  /// @brief Stop the teleoperation thread and destroy the teleoperation
+  ~Teleoperation();
+
+  Teleoperation(const Teleoperation &) = delete;
+  Teleoperation & operator=(const Teleoperation &) = delete;
+
+  /**
+   * @brief Get the number of leader updates forwarded to the follower since construction
+   *
+   * @return Number of updates
+   *
+   * @note If the teleoperation thread failed, the exception it caught is rethrown here
+   */
+  uint64_t get_num_updates();
+
+private:
+  // Driver of the leader
+  TrossenArmDriver & driver_leader_;
+
+  // Driver of the follower
+  TrossenArmDriver & driver_follower_;
+
+  // Index of the leader joint driving every follower joint
+  std::vector<size_t> joint_mapping_{};
+
+  // Scale from the leader joint to every follower joint
+  std::vector<double> joint_scales_{};
+
+  // Offset added to every scaled follower position
+  std::vector<double> joint_offsets_{};
+
+  // Gain from the follower external efforts to the leader external efforts
+  double force_feedback_gain_{0.0};
+
+  // Whether to feed the leader velocities forward to the follower
+  bool feedforward_velocities_{true};
+
+  // Polling period
+  std::chrono::steady_clock::duration period_{};
+
+  // Latest robot output of the leader
+  FixedRobotOutput robot_output_leader_{};
+
+  // Latest robot output of the follower
+  FixedRobotOutput robot_output_follower_{};
+
+  // Goal positions of the follower
+  std::vector<double> goal_positions_{};
+
+  // Goal feedforward velocities of the follower
+  std::optional<std::vector<double>> goal_feedforward_velocities_{};
+
+  // Goal external efforts of the leader
+  std::vector<double> goal_external_efforts_{};
+
+  // Number of leader updates forwarded to the follower
+  std::atomic<uint64_t> num_updates_{0};
+
+  // Atomic flag for maintaining and stopping the teleoperation thread
+  std::atomic<bool> activated_{true};
+
+  // Atomic flag set once exception_ptr_ holds the teleoperation thread's exception
+  std::atomic<bool> failed_{false};
+
+  // Exception caught in the teleoperation thread
+  std::exception_ptr exception_ptr_{nullptr};
+
+  // Teleoperation thread
+  std::thread teleoperation_thread_{};
+
+  /**
+   * @brief Forward the latest leader robot output to the follower and the follower external
+   * efforts back to the leader
+   */
+  void update();
+
+  /**
+   * @brief Function to be executed by the teleoperation thread
+   *
+   * @details The teleoperation thread will repeatedly do the following:
+   *
+   * 1. Read the leader robot output
+   *
+   * 2. Update the follower and the leader if the leader robot output holds a new daemon cycle
+   *
+   * 3. Sleep until the next polling period
+   */
+  void run();
+};
+
+inline Teleoperation::Teleoperation(
+  TrossenArmDriver & driver_leader,
+  TrossenArmDriver & driver_follower,
+  const TeleoperationConfiguration & configuration
+)
+: driver_leader_(driver_leader),
+  driver_follower_(driver_follower),
+  joint_mapping_(configuration.joint_mapping),
+  joint_scales_(configuration.joint_scales),
+  joint_offsets_(configuration.joint_offsets),
+  force_feedback_gain_(configuration.force_feedback_gain),
+  feedforward_velocities_(configuration.feedforward_velocities),
+  period_(
+    std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double>(configuration.period)
+    )
+  )
+{
+  const size_t num_joints_leader = driver_leader_.get_num_joints();
+  const size_t num_joints_follower = driver_follower_.get_num_joints();
+  if (joint_mapping_.empty()) {
+    if (num_joints_leader != num_joints_follower) {
+      throw LogicError(
+        "A joint mapping is required for arms with different numbers of joints: " +
+        std::to_string(num_joints_leader) + " != " + std::to_string(num_joints_follower)
+      );
+    }
+    for (size_t i = 0; i < num_joints_follower; ++i) {
+      joint_mapping_.push_back(i);
+    }
+  }
+  if (joint_scales_.empty()) {
+    joint_scales_.assign(num_joints_follower, 1.0);
+  }
+  if (joint_offsets_.empty()) {
+    joint_offsets_.assign(num_joints_follower, 0.0);
+  }
+  if (
+    joint_mapping_.size() != num_joints_follower ||
+    joint_scales_.size() != num_joints_follower ||
+    joint_offsets_.size() != num_joints_follower)
+  {
+    throw LogicError(
+      "Invalid teleoperation configuration size: expected " +
+      std::to_string(num_joints_follower) + " follower joints"
+    );
+  }
+  for (size_t leader_index : joint_mapping_) {
+    if (leader_index >= num_joints_leader) {
+      throw LogicError(
+        "Invalid leader joint index in the joint mapping: " + std::to_string(leader_index)
+      );
+    }
+  }
+  if (configuration.period <= 0.0) {
+    throw LogicError("Teleoperation period must be positive");
+  }
+  for (const Mode mode : driver_leader_.get_modes()) {
+    if (mode != Mode::external_effort) {
+      throw LogicError("All leader joints must be in external effort mode to teleoperate");
+    }
+  }
+  for (const Mode mode : driver_follower_.get_modes()) {
+    if (mode != Mode::position) {
+      throw LogicError("All follower joints must be in position mode to teleoperate");
+    }
+  }
+  goal_positions_.resize(num_joints_follower);
+  if (feedforward_velocities_) {
+    goal_feedforward_velocities_.emplace(num_joints_follower);
+  }
+  goal_external_efforts_.resize(num_joints_leader);
+  teleoperation_thread_ = std::thread(&Teleoperation::run, this);
+}
+
+inline Teleoperation::~Teleoperation()
+{
+  activated_.store(false, std::memory_order_relaxed);
+  if (teleoperation_thread_.joinable()) {
+    teleoperation_thread_.join();
+  }
+  // Release the leader instead of leaving the last force feedback applied
+  try {
+    std::fill(goal_external_efforts_.begin(), goal_external_efforts_.end(), 0.0);
+    driver_leader_.set_all_external_efforts(goal_external_efforts_, 0.0, false);
+  } catch (...) {
+  }
+}
+
+inline uint64_t Teleoperation::get_num_updates()
+{
+  if (failed_.load(std::memory_order_acquire)) {
+    std::rethrow_exception(exception_ptr_);
+  }
+  return num_updates_.load(std::memory_order_relaxed);
+}
+
+inline void Teleoperation::update()
+{
+  for (size_t i = 0; i < goal_positions_.size(); ++i) {
+    const size_t leader_index = joint_mapping_[i];
+    goal_positions_[i] =
+      joint_scales_[i] * robot_output_leader_.joint.positions[leader_index] +
+      joint_offsets_[i];
+    if (goal_feedforward_velocities_) {
+      (*goal_feedforward_velocities_)[i] =
+        joint_scales_[i] * robot_output_leader_.joint.velocities[leader_index];
+    }
+  }
+  driver_follower_.set_all_positions(goal_positions_, 0.0, false, goal_feedforward_velocities_);
+
+  driver_follower_.get_robot_output(robot_output_follower_);
+  std::fill(goal_external_efforts_.begin(), goal_external_efforts_.end(), 0.0);
+  for (size_t i = 0; i < goal_positions_.size(); ++i) {
+    goal_external_efforts_[joint_mapping_[i]] -=
+      force_feedback_gain_ * joint_scales_[i] *
+      robot_output_follower_.joint.external_efforts[i];
+  }
+  driver_leader_.set_all_external_efforts(goal_external_efforts_, 0.0, false);
+}
+
+inline void Teleoperation::run()
+{
+  auto next_time = std::chrono::steady_clock::now();
+  uint32_t last_id{0};
+  bool first_cycle{true};
+  try {
+    while (activated_.load(std::memory_order_relaxed)) {
+      driver_leader_.get_robot_output(robot_output_leader_);
+      if (first_cycle || robot_output_leader_.header.id != last_id) {
+        first_cycle = false;
+        last_id = robot_output_leader_.header.id;
+        update();
+        num_updates_.fetch_add(1, std::memory_order_relaxed);
+      }
+      // Skip the missed periods instead of updating in a burst to catch up
+      next_time = std::max(next_time + period_, std::chrono::steady_clock::now());
+      std::this_thread::sleep_until(next_time);
+    }
+  } catch (...) {
+    exception_ptr_ = std::current_exception();
+    failed_.store(true, std::memory_order_release);
+  }
+}
+
+}  // namespace trossen_arm
+
+#endif  // LIBTROSSEN_ARM__TROSSEN_ARM_TELEOPERATION_HPP_
@@ -29,8 +29,10 @@
 #ifndef LIBTROSSEN_ARM__TROSSEN_ARM_TYPE_HPP_
 #define LIBTROSSEN_ARM__TROSSEN_ARM_TYPE_HPP_
 
+#include <cstddef>
 #include <cstdint>
 
+#include <algorithm>
 #include <array>
 #include <functional>
 #include <map>
@@ -221,6 +223,28 @@ struct AlgorithmParameter
   double singularity_threshold{0.0};
 };
 
+/** @brief Scheduling options of the daemon thread */
+struct DaemonOptions
+{
+  /**
+   * @brief Real-time priority of the daemon thread under SCHED_FIFO
+   * @note It must be within the SCHED_FIFO priority range, usually [1, 99], or 0 to keep the
+   * default scheduling policy
+   */
+  int realtime_priority{0};
+  /**
+   * @brief Indices of the CPUs the daemon thread is allowed to run on
+   * @note Every index must be within [0, CPU_SETSIZE), empty keeps the default affinity
+   */
+  std::vector<int> cpu_affinity{};
+  /**
+   * @brief Whether to lock all current and future memory pages of the process
+   * @note This calls mlockall(), which affects the whole process and not only the driver, and is
+   * not undone by cleanup()
+   */
+  bool lock_memory{false};
+};
+
 /// @brief Robot output
 struct RobotOutput
 {
@@ -334,6 +358,128 @@ struct RobotOutput
   } cartesian{};
 };
 
+/// @brief Maximum number of joints among all models
+inline constexpr uint8_t MAX_NUM_JOINTS{7};
+
+/**
+ * @brief Nominal period of the driver's daemon cycle in s
+ *
+ * @details Goals with a goal time up to this period are applied in a single cycle. Threads
+ * polling the driver should not do so more often, since every getter call preempts the daemon
+ * thread.
+ */
+inline constexpr double DAEMON_PERIOD{0.001};
+
+/// @brief Read-only view of a contiguous range of joint values
+struct JointView
+{
+  /// @brief Pointer to the first value
+  const double * data{nullptr};
+  /// @brief Number of values
+  size_t size{0};
+
+  /// @brief Get the value at the given index
+  const double & operator[](size_t index) const
+  {
+    return data[index];
+  }
+
+  /// @brief Get the iterator to the first value
+  const double * begin() const
+  {
+    return data;
+  }
+
+  /// @brief Get the iterator past the last value
+  const double * end() const
+  {
+    return data + size;
+  }
+};
+
+/**
+ * @brief Robot output stored in fixed-capacity contiguous arrays
+ *
+ * @details Every joint quantity is stored once for all joints in a std::array of capacity
+ * MAX_NUM_JOINTS, with the arm joints first and the gripper joint last. The arm and gripper
+ * outputs are views into these arrays instead of separate copies, so the structure holds no heap
+ * memory and is trivially copyable.
+ */
+struct FixedRobotOutput
+{
+  /// @brief Values of one quantity for all joints
+  using JointArray = std::array<double, MAX_NUM_JOINTS>;
+
+  /// @brief Header
+  RobotOutput::Header header{};
+
+  /// @brief Number of joints, the gripper joint included
+  uint8_t num_joints{0};
+
+  /// @brief Outputs of all joints
+  struct Joint
+  {
+    /// @brief Positions in rad for arm joints and m for the gripper joint
+    JointArray positions{};
+    /// @brief Velocities in rad/s for arm joints and m/s for the gripper joint
+    JointArray velocities{};
+    /// @brief Accelerations in rad/s^2 for arm joints and m/s^2 for the gripper joint
+    JointArray accelerations{};
+    /// @brief Efforts in Nm for arm joints and N for the gripper joint
+    JointArray efforts{};
+    /// @brief External efforts in Nm for arm joints and N for the gripper joint
+    JointArray external_efforts{};
+    /// @brief Compensation efforts in Nm for arm joints and N for the gripper joint
+    JointArray compensation_efforts{};
+    /// @brief Rotor temperatures in C
+    JointArray rotor_temperatures{};
+    /// @brief Driver temperatures in C
+    JointArray driver_temperatures{};
+  } joint{};
+
+  /// @brief Outputs in Cartesian space
+  RobotOutput::Cartesian cartesian{};
+
+  /**
+   * @brief Get the values of all joints
+   *
+   * @param values One of the joint arrays of this structure
+   * @return View of the values of all joints
+   */
+  JointView all(const JointArray & values) const
+  {
+    return {values.data(), num_joints};
+  }
+
+  /**
+   * @brief Get the values of the arm joints
+   *
+   * @param values One of the joint arrays of this structure
+   * @return View of the values of the arm joints
+   */
+  JointView arm(const JointArray & values) const
+  {
+    return {values.data(), num_joints > 0 ? num_joints - 1u : 0u};
+  }
+
+  /**
+   * @brief Get the value of the gripper joint
+   *
+   * @param values One of the joint arrays of this structure
+   * @return Value of the gripper joint
+   *
+   * @note This structure must hold a robot output, see assign()
+   */
+  double gripper(const JointArray & values) const;
+
+  /**
+   * @brief Copy a robot output into this structure
+   *
+   * @param robot_output The robot output to copy
+   */
+  void assign(const RobotOutput & robot_output);
+};
+
 /// @brief Inherited logic error
 class LogicError : public std::logic_error
 {
@@ -348,6 +494,52 @@ public:
   using std::runtime_error::runtime_error;
 };
 
+inline double FixedRobotOutput::gripper(const JointArray & values) const
+{
+  if (num_joints == 0) {
+    throw LogicError("FixedRobotOutput holds no robot output");
+  }
+  return values[num_joints - 1];
+}
+
+inline void FixedRobotOutput::assign(const RobotOutput & robot_output)
+{
+  const auto & all = robot_output.joint.all;
+  if (all.positions.size() > MAX_NUM_JOINTS) {
+    throw LogicError(
+      "Number of joints " + std::to_string(all.positions.size()) + " exceeds the capacity " +
+      std::to_string(MAX_NUM_JOINTS)
+    );
+  }
+  header = robot_output.header;
+  num_joints = static_cast<uint8_t>(all.positions.size());
+  std::copy(all.positions.begin(), all.positions.end(), joint.positions.begin());
+  std::copy(all.velocities.begin(), all.velocities.end(), joint.velocities.begin());
+  std::copy(all.accelerations.begin(), all.accelerations.end(), joint.accelerations.begin());
+  std::copy(all.efforts.begin(), all.efforts.end(), joint.efforts.begin());
+  std::copy(
+    all.external_efforts.begin(),
+    all.external_efforts.end(),
+    joint.external_efforts.begin()
+  );
+  std::copy(
+    all.compensation_efforts.begin(),
+    all.compensation_efforts.end(),
+    joint.compensation_efforts.begin()
+  );
+  std::copy(
+    all.rotor_temperatures.begin(),
+    all.rotor_temperatures.end(),
+    joint.rotor_temperatures.begin()
+  );
+  std::copy(
+    all.driver_temperatures.begin(),
+    all.driver_temperatures.end(),
+    joint.driver_temperatures.begin()
+  );
+  cartesian = robot_output.cartesian;
+}
+
 /// @brief Forward declaration of the QuinticHermiteInterpolator class
 class QuinticHermiteInterpolator;
 
@@ -0,0 +1,170 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of the batch kinematics:
+// 1. detail::parallel_for covers its range exactly once for any number of threads and rethrows
+//    the first exception by chunk order after all chunks are done
+// 2. BatchKinematics agrees with ArmKinematics applied serially
+
+#include <cstddef>
+
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_kinematics.hpp"
+#include "libtrossen_arm/trossen_arm_type.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::ArmKinematics;
+using trossen_arm::BatchKinematics;
+
+void test_parallel_for()
+{
+  for (size_t size : {0, 1, 10, 1000}) {
+    for (size_t num_threads : {0, 1, 3, 7, 2000}) {
+      const std::string name =
+        "size " + std::to_string(size) + " with " + std::to_string(num_threads) + " threads";
+      std::vector<std::atomic<int>> visits(size);
+      trossen_arm::detail::parallel_for(
+        size,
+        num_threads,
+        [&visits](size_t begin, size_t end) {
+          for (size_t i = begin; i < end; ++i) {
+            ++visits[i];
+          }
+        }
+      );
+      bool once{true};
+      for (const auto & visit : visits) {
+        once = once && visit.load() == 1;
+      }
+      test_utils::check(once, name + ": every index is visited once");
+    }
+  }
+
+  // Chunks of 10 over 4 threads, the second and third throwing
+  std::atomic<size_t> num_done{0};
+  std::string message;
+  try {
+    trossen_arm::detail::parallel_for(
+      40,
+      4,
+      [&num_done](size_t begin, size_t end) {
+        if (begin == 10 || begin == 20) {
+          throw std::runtime_error("chunk " + std::to_string(begin) + "-" + std::to_string(end));
+        }
+        ++num_done;
+      }
+    );
+  } catch (const std::runtime_error & error) {
+    message = error.what();
+  }
+  test_utils::check(message == "chunk 10-20", "first exception by chunk order is rethrown");
+  test_utils::check(num_done.load() == 2, "other chunks complete before the rethrow");
+}
+
+void test_batch_matches_serial()
+{
+  const std::vector<trossen_arm::Joint> & joints = trossen_arm::StandardJoints::wxai_v0_20260626;
+  const trossen_arm::EndEffector & end_effector = trossen_arm::StandardEndEffector::wxai_v0_base;
+  const ArmKinematics kinematics(joints, end_effector);
+
+  std::vector<ArmKinematics::JointPositions> joint_positions(257);
+  for (size_t s = 0; s < joint_positions.size(); ++s) {
+    for (size_t i = 0; i < ArmKinematics::NUM_ARM_JOINTS; ++i) {
+      joint_positions[s][i] = 0.3 + 0.9 * std::sin(0.37 * static_cast<double>(s) + i);
+    }
+  }
+  const auto cartesian_positions = BatchKinematics::forward(
+    trossen_arm::Model::wxai_v0, joints, end_effector, joint_positions, 4
+  );
+  const auto jacobians = BatchKinematics::compute_jacobians(
+    trossen_arm::Model::wxai_v0, joints, end_effector, joint_positions, 4
+  );
+  std::vector<ArmKinematics::JointPositions> seeds(joint_positions.size());
+  for (size_t s = 0; s < seeds.size(); ++s) {
+    seeds[s] = joint_positions[s];
+    seeds[s][0] += 0.05;
+  }
+  std::vector<ArmKinematics::JointPositions> solutions;
+  const auto results = BatchKinematics::inverse(
+    joints, end_effector, cartesian_positions, seeds, solutions, 4
+  );
+  test_utils::check(cartesian_positions.size() == joint_positions.size(), "forward batch size");
+  test_utils::check(jacobians.size() == joint_positions.size(), "Jacobian batch size");
+  test_utils::check(solutions.size() == joint_positions.size(), "inverse batch size");
+
+  for (size_t s = 0; s < joint_positions.size(); ++s) {
+    const std::string name = "configuration " + std::to_string(s);
+    const ArmKinematics::CartesianPositions expected = kinematics.forward(joint_positions[s]);
+    const ArmKinematics::Jacobian expected_jacobian =
+      kinematics.compute_jacobian(joint_positions[s]);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      test_utils::check_near(
+        cartesian_positions[s][i], expected[i], 1e-12, name + ": forward " + std::to_string(i)
+      );
+    }
+    for (size_t i = 0; i < expected_jacobian.size(); ++i) {
+      test_utils::check_near(
+        jacobians[s][i], expected_jacobian[i], 1e-12, name + ": Jacobian " + std::to_string(i)
+      );
+    }
+    ArmKinematics::JointPositions expected_solution{};
+    const trossen_arm::InverseKinematicsResult expected_result = kinematics.inverse(
+      cartesian_positions[s], seeds[s], expected_solution
+    );
+    test_utils::check(results[s].success == expected_result.success, name + ": inverse success");
+    test_utils::check(solutions[s] == expected_solution, name + ": inverse solution");
+  }
+
+  bool thrown{false};
+  try {
+    BatchKinematics::inverse(
+      joints, end_effector, cartesian_positions, {seeds[0], seeds[1]}, solutions
+    );
+  } catch (const trossen_arm::LogicError &) {
+    thrown = true;
+  }
+  test_utils::check(thrown, "mismatched number of seeds is rejected");
+}
+
+}  // namespace
+
+int main()
+{
+  test_parallel_for();
+  test_batch_matches_serial();
+  return test_utils::report("test_batch_kinematics");
+}
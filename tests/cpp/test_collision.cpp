@@ -0,0 +1,257 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of the collision checking:
+// 1. The segment distance matches known distances, including parallel and degenerate segments,
+//    and a brute-force search on random segments
+// 2. CollisionChecker clears the zero configuration and detects folded self-collisions
+// 3. CollisionChecker::clamp() keeps the collision-free part of a motion to the bisection
+//    resolution
+// 4. TrajectoryPlayer holds the last collision-free command at rest on a collision
+
+#include <cstddef>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_collision.hpp"
+#include "libtrossen_arm/trossen_arm_streaming.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::ArmKinematics;
+using trossen_arm::BatchQuinticHermiteInterpolator;
+using trossen_arm::CollisionChecker;
+namespace detail = trossen_arm::detail;
+
+/**
+ * @brief Make a checker of the standard WXAI V0 chain
+ *
+ * @param workspace_max_z Height of the workspace ceiling in m
+ * @return Collision checker
+ */
+CollisionChecker make_checker(
+  double workspace_max_z = std::numeric_limits<double>::infinity()
+)
+{
+  trossen_arm::CollisionCheckerConfiguration configuration;
+  configuration.workspace_max[2] = workspace_max_z;
+  return CollisionChecker(
+    trossen_arm::StandardJoints::wxai_v0_20260626,
+    trossen_arm::StandardEndEffector::wxai_v0_base,
+    configuration
+  );
+}
+
+void test_segment_distance()
+{
+  struct Case
+  {
+    std::string name;
+    std::array<detail::Vector3, 4> points;
+    double distance;
+  };
+  const std::vector<Case> cases{
+    {"skew crossing", {{{-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.0, -1.0, 1.0}, {0.0, 1.0, 1.0}}},
+      1.0},
+    {"closest at endpoints", {{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {2.0, 1.0, 0.0}, {2.0, 3.0, 0.0}}},
+      std::sqrt(2.0)},
+    {"parallel overlapping", {{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {0.5, 2.0, 0.0}, {1.5, 2.0, 0.0}}},
+      2.0},
+    {"parallel disjoint", {{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {3.0, 1.0, 0.0}, {2.0, 1.0, 0.0}}},
+      std::sqrt(2.0)},
+    {"collinear disjoint", {{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {2.0, 0.0, 0.0}, {3.0, 0.0, 0.0}}},
+      1.0},
+    {"both points", {{{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {1.0, 2.0, 2.0}, {1.0, 2.0, 2.0}}}, 3.0},
+    {"first point", {{{0.0, 1.0, 0.0}, {0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}}}, 1.0},
+    {"second point beyond the end",
+      {{{-1.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, {3.0, 0.0, 0.0}, {3.0, 0.0, 0.0}}}, 2.0},
+  };
+  for (const Case & c : cases) {
+    const auto & p = c.points;
+    test_utils::check_near(
+      detail::compute_segment_distance(p[0], p[1], p[2], p[3]), c.distance, 1e-12, c.name
+    );
+    test_utils::check_near(
+      detail::compute_segment_distance(p[2], p[3], p[0], p[1]), c.distance, 1e-12,
+      c.name + " swapped"
+    );
+  }
+
+  // Compare random segments with a brute-force search over sampled points, which overestimates
+  // the distance by at most half the sampling step along both segments
+  constexpr size_t NUM_STEPS{200};
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  for (size_t s = 0; s < 20; ++s) {
+    std::array<detail::Vector3, 4> p;
+    for (auto & point : p) {
+      for (double & coordinate : point) {
+        coordinate = distribution(generator);
+      }
+    }
+    const double distance = detail::compute_segment_distance(p[0], p[1], p[2], p[3]);
+    const detail::Vector3 d1 = detail::subtract(p[1], p[0]);
+    const detail::Vector3 d2 = detail::subtract(p[3], p[2]);
+    double brute_force = std::numeric_limits<double>::infinity();
+    for (size_t i = 0; i <= NUM_STEPS; ++i) {
+      for (size_t j = 0; j <= NUM_STEPS; ++j) {
+        const detail::Vector3 difference = detail::subtract(
+          detail::add(p[0], detail::scale(d1, static_cast<double>(i) / NUM_STEPS)),
+          detail::add(p[2], detail::scale(d2, static_cast<double>(j) / NUM_STEPS))
+        );
+        brute_force = std::min(brute_force, std::sqrt(detail::dot(difference, difference)));
+      }
+    }
+    const double resolution = 0.5 / NUM_STEPS * (
+      std::sqrt(detail::dot(d1, d1)) + std::sqrt(detail::dot(d2, d2))
+    );
+    const std::string name = "random segments " + std::to_string(s);
+    test_utils::check(distance <= brute_force + 1e-12, name + " not above the brute force");
+    test_utils::check(distance >= brute_force - resolution, name + " within the resolution");
+  }
+}
+
+void test_self_collision()
+{
+  const CollisionChecker checker = make_checker();
+  const trossen_arm::CollisionResult rest = checker.check({});
+  test_utils::check(rest.is_safe(), "zero configuration is clear with the excluded pairs");
+  test_utils::check(rest.clearance > 0.0, "zero configuration has a positive clearance");
+
+  ArmKinematics::JointPositions folded_elbow{};
+  folded_elbow[2] = -0.1;
+  const trossen_arm::CollisionResult elbow = checker.check(folded_elbow);
+  test_utils::check(elbow.self_collision, "forearm folded into the upper arm collides");
+  test_utils::check(!elbow.workspace_violation, "folded elbow stays in the workspace");
+
+  ArmKinematics::JointPositions folded_wrist{0.0, 1.0, 1.0, 0.0, 2.5, 0.0};
+  test_utils::check(
+    checker.check(folded_wrist).self_collision,
+    "end effector folded into the forearm collides"
+  );
+}
+
+void test_clamp()
+{
+  const CollisionChecker checker = make_checker(0.25);
+  const ArmKinematics::JointPositions start{};
+  const ArmKinematics::JointPositions goal{0.0, 0.5, 0.5, 0.0, 0.0, 0.0};
+
+  ArmKinematics::JointPositions safe_goal{0.5, 0.0, 0.0, 0.0, 0.0, 0.0};
+  const ArmKinematics::JointPositions safe_goal_copy = safe_goal;
+  test_utils::check(checker.clamp(start, safe_goal) == 1.0, "safe motion is kept whole");
+  test_utils::check(safe_goal == safe_goal_copy, "safe goal is left untouched");
+
+  constexpr size_t num_bisections{10};
+  ArmKinematics::JointPositions clamped = goal;
+  const double fraction = checker.clamp(start, clamped, num_bisections);
+  test_utils::check(fraction > 0.0 && fraction < 1.0, "motion into the ceiling is cut short");
+  test_utils::check(checker.check(clamped).is_safe(), "clamped goal is clear");
+  const double resolution = std::ldexp(1.0, -static_cast<int>(num_bisections));
+  ArmKinematics::JointPositions beyond;
+  for (size_t i = 0; i < beyond.size(); ++i) {
+    test_utils::check_near(
+      clamped[i],
+      start[i] + fraction * (goal[i] - start[i]),
+      1e-12,
+      "clamped goal lies on the motion, joint " + std::to_string(i)
+    );
+    beyond[i] = start[i] + (fraction + resolution) * (goal[i] - start[i]);
+  }
+  test_utils::check(
+    !checker.check(beyond).is_safe(),
+    "one bisection step beyond the clamped goal collides"
+  );
+
+  ArmKinematics::JointPositions unbisected = goal;
+  test_utils::check(checker.clamp(start, unbisected, 0) == 0.0, "no bisection keeps nothing");
+  test_utils::check(unbisected == start, "no bisection moves the goal back to the start");
+}
+
+void test_player_hold()
+{
+  const CollisionChecker checker = make_checker(0.25);
+  trossen_arm::TrajectoryPlayer player(std::vector<double>(7, 0.0), checker);
+  trossen_arm::SpscQueue<trossen_arm::StreamWaypoint> queue(4);
+  trossen_arm::StreamWaypoint waypoint;
+  waypoint.positions = {0.0, 0.5, 0.5, 0.0, 0.0, 0.0, 0.0};
+  waypoint.duration = 0.5;
+  queue.try_push(waypoint);
+
+  BatchQuinticHermiteInterpolator::Channels positions{};
+  BatchQuinticHermiteInterpolator::Channels velocities{};
+  BatchQuinticHermiteInterpolator::Channels accelerations{};
+  BatchQuinticHermiteInterpolator::Channels last_positions{};
+  size_t num_collisions{0};
+  bool held{true};
+  BatchQuinticHermiteInterpolator::Channels held_positions{};
+  const auto is_zero = [](double value) {return value == 0.0;};
+  for (size_t n = 0; n < 100; ++n) {
+    if (player.step(queue, 0, positions, velocities, accelerations).collision) {
+      ++num_collisions;
+      held_positions = positions;
+      test_utils::check(
+        positions == last_positions,
+        "collision holds the last collision-free command"
+      );
+    }
+    if (num_collisions > 0) {
+      held = held && positions == held_positions;
+      held = held && std::all_of(velocities.begin(), velocities.end(), is_zero);
+      held = held && std::all_of(accelerations.begin(), accelerations.end(), is_zero);
+    }
+    last_positions = positions;
+    player.advance(0.01);
+  }
+  test_utils::check(num_collisions == 1, "collision is reported once while holding");
+  test_utils::check(held, "held positions stay at rest after the collision");
+  ArmKinematics::JointPositions arm_positions;
+  std::copy_n(held_positions.begin(), arm_positions.size(), arm_positions.begin());
+  test_utils::check(checker.check(arm_positions).is_safe(), "held positions are clear");
+  test_utils::check(held_positions[1] > 0.0, "arm rose before the collision");
+}
+
+}  // namespace
+
+int main()
+{
+  test_segment_distance();
+  test_self_collision();
+  test_clamp();
+  test_player_hold();
+  return test_utils::report("test_collision");
+}
@@ -0,0 +1,230 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of ArmDynamics on the standard WXAI V0 arm:
+// 1. The mass matrix is symmetric with a positive diagonal
+// 2. The gravity efforts are the gradient of a potential, so their work is path independent and
+//    their Jacobian is symmetric
+// 3. The inverse dynamics are the sum of the inertial and gravity efforts
+
+#include <cstddef>
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_dynamics.hpp"
+#include "libtrossen_arm/trossen_arm_type.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::ArmDynamics;
+
+// Number of sampled configurations
+constexpr size_t NUM_SAMPLES{50};
+
+/**
+ * @brief Sample values of all joints within ranges
+ *
+ * @param generator Random number generator
+ * @param low Lower bound of the arm joints
+ * @param high Upper bound of the arm joints
+ * @param gripper_high Upper bound of the gripper joint, the lower bound being 0
+ * @return Values of all joints
+ */
+ArmDynamics::JointVector sample(
+  std::mt19937 & generator,
+  double low,
+  double high,
+  double gripper_high
+)
+{
+  ArmDynamics::JointVector values{};
+  for (size_t i = 0; i < ArmDynamics::NUM_ARM_JOINTS; ++i) {
+    values[i] = std::uniform_real_distribution<double>(low, high)(generator);
+  }
+  values[ArmDynamics::NUM_ARM_JOINTS] =
+    std::uniform_real_distribution<double>(0.0, gripper_high)(generator);
+  return values;
+}
+
+void test_mass_matrix(
+  const ArmDynamics & dynamics,
+  const std::vector<ArmDynamics::JointVector> & q
+)
+{
+  constexpr size_t n{ArmDynamics::NUM_JOINTS};
+  for (size_t s = 0; s < q.size(); ++s) {
+    const std::string name = "sample " + std::to_string(s);
+    // Column j of the mass matrix is the inertial efforts of a unit acceleration of joint j
+    std::array<ArmDynamics::JointVector, n> columns{};
+    for (size_t j = 0; j < n; ++j) {
+      ArmDynamics::JointVector accelerations{};
+      accelerations[j] = 1.0;
+      columns[j] = dynamics.compute_inertial_efforts(q[s], {}, accelerations);
+    }
+    for (size_t i = 0; i < n; ++i) {
+      test_utils::check(columns[i][i] > 0.0, name + ": mass matrix diagonal " + std::to_string(i));
+      for (size_t j = 0; j < i; ++j) {
+        test_utils::check_near(
+          columns[j][i],
+          columns[i][j],
+          1e-12,
+          name + ": mass matrix (" + std::to_string(i) + ", " + std::to_string(j) + ")"
+        );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Integrate the work of the gravity efforts along a straight line with Simpson's rule
+ *
+ * @param dynamics Dynamics
+ * @param from Positions at the start of the line
+ * @param to Positions at the end of the line
+ * @return Work, the potential difference between the ends
+ */
+double integrate_gravity_work(
+  const ArmDynamics & dynamics,
+  const ArmDynamics::JointVector & from,
+  const ArmDynamics::JointVector & to
+)
+{
+  constexpr size_t num_intervals{200};
+  double work{0.0};
+  for (size_t k = 0; k <= num_intervals; ++k) {
+    const double s = static_cast<double>(k) / num_intervals;
+    ArmDynamics::JointVector positions{};
+    for (size_t i = 0; i < ArmDynamics::NUM_JOINTS; ++i) {
+      positions[i] = from[i] + s * (to[i] - from[i]);
+    }
+    const ArmDynamics::JointVector efforts = dynamics.compute_gravity_efforts(positions);
+    double power{0.0};
+    for (size_t i = 0; i < ArmDynamics::NUM_JOINTS; ++i) {
+      power += efforts[i] * (to[i] - from[i]);
+    }
+    const double weight = (k == 0 || k == num_intervals) ? 1.0 : (k % 2 == 1 ? 4.0 : 2.0);
+    work += weight * power;
+  }
+  return work / (3.0 * num_intervals);
+}
+
+void test_gravity_potential(
+  const ArmDynamics & dynamics,
+  const std::vector<ArmDynamics::JointVector> & q
+)
+{
+  constexpr double step{1e-6};
+  for (size_t s = 0; s + 2 < q.size(); s += 3) {
+    const std::string name = "sample " + std::to_string(s);
+    // The potential difference does not depend on the path
+    const double direct = integrate_gravity_work(dynamics, q[s], q[s + 1]);
+    const double detour = integrate_gravity_work(dynamics, q[s], q[s + 2]) +
+      integrate_gravity_work(dynamics, q[s + 2], q[s + 1]);
+    test_utils::check_near(direct, detour, 1e-7, name + ": gravity work path independence");
+
+    // The Jacobian of the gradient of a potential is its symmetric Hessian
+    std::array<ArmDynamics::JointVector, ArmDynamics::NUM_JOINTS> derivatives{};
+    for (size_t j = 0; j < ArmDynamics::NUM_JOINTS; ++j) {
+      ArmDynamics::JointVector forward = q[s];
+      ArmDynamics::JointVector backward = q[s];
+      forward[j] += step;
+      backward[j] -= step;
+      const ArmDynamics::JointVector efforts_forward = dynamics.compute_gravity_efforts(forward);
+      const ArmDynamics::JointVector efforts_backward = dynamics.compute_gravity_efforts(backward);
+      for (size_t i = 0; i < ArmDynamics::NUM_JOINTS; ++i) {
+        derivatives[j][i] = (efforts_forward[i] - efforts_backward[i]) / (2.0 * step);
+      }
+    }
+    for (size_t i = 0; i < ArmDynamics::NUM_JOINTS; ++i) {
+      for (size_t j = 0; j < i; ++j) {
+        test_utils::check_near(
+          derivatives[j][i],
+          derivatives[i][j],
+          1e-6,
+          name + ": gravity Jacobian (" + std::to_string(i) + ", " + std::to_string(j) + ")"
+        );
+      }
+    }
+
+    // Gravity along the base joint axis exerts no effort on it
+    test_utils::check_near(
+      dynamics.compute_gravity_efforts(q[s])[0], 0.0, 1e-12, name + ": base joint gravity"
+    );
+  }
+}
+
+void test_inverse_dynamics(
+  const ArmDynamics & dynamics,
+  const std::vector<ArmDynamics::JointVector> & q,
+  const std::vector<ArmDynamics::JointVector> & v,
+  const std::vector<ArmDynamics::JointVector> & a
+)
+{
+  const std::vector<ArmDynamics::JointVector> efforts = dynamics.compute_inverse_dynamics(q, v, a);
+  for (size_t s = 0; s < q.size(); ++s) {
+    const ArmDynamics::JointVector inertial = dynamics.compute_inertial_efforts(q[s], v[s], a[s]);
+    const ArmDynamics::JointVector gravity = dynamics.compute_gravity_efforts(q[s]);
+    for (size_t i = 0; i < ArmDynamics::NUM_JOINTS; ++i) {
+      test_utils::check_near(
+        efforts[s][i],
+        inertial[i] + gravity[i],
+        1e-12,
+        "sample " + std::to_string(s) + ": inverse dynamics " + std::to_string(i)
+      );
+    }
+  }
+}
+
+}  // namespace
+
+int main()
+{
+  const ArmDynamics dynamics(
+    trossen_arm::StandardJoints::wxai_v0_20260626,
+    trossen_arm::StandardLinks::wxai_v0_20260626
+  );
+  std::mt19937 generator(42);
+  std::vector<ArmDynamics::JointVector> positions(NUM_SAMPLES);
+  std::vector<ArmDynamics::JointVector> velocities(NUM_SAMPLES);
+  std::vector<ArmDynamics::JointVector> accelerations(NUM_SAMPLES);
+  for (size_t s = 0; s < NUM_SAMPLES; ++s) {
+    positions[s] = sample(generator, -2.0, 2.0, 0.04);
+    velocities[s] = sample(generator, -3.0, 3.0, 0.1);
+    accelerations[s] = sample(generator, -10.0, 10.0, 1.0);
+  }
+  test_mass_matrix(dynamics, positions);
+  test_gravity_potential(dynamics, positions);
+  test_inverse_dynamics(dynamics, positions, velocities, accelerations);
+  return test_utils::report("test_dynamics");
+}
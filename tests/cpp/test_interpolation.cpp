@@ -0,0 +1,186 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of the interpolators:
+// 1. BatchQuinticHermiteInterpolator meets its boundary conditions
+// 2. CubicSplinePath passes through its waypoints, starts and ends at rest with zero
+//    accelerations, and is continuous in positions, velocities, and accelerations
+
+#include <cstddef>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_interpolation.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::BatchQuinticHermiteInterpolator;
+using trossen_arm::CubicSplinePath;
+
+void test_quintic_boundaries()
+{
+  constexpr size_t num_channels{7};
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-2.0, 2.0);
+  for (size_t s = 0; s < 20; ++s) {
+    const std::string name = "quintic " + std::to_string(s);
+    std::array<BatchQuinticHermiteInterpolator::Channels, 6> boundaries{};
+    for (auto & boundary : boundaries) {
+      std::generate_n(boundary.begin(), num_channels, [&]() {return distribution(generator);});
+    }
+    const double duration = 0.1 + 0.1 * static_cast<double>(s);
+    BatchQuinticHermiteInterpolator interpolator;
+    interpolator.compute_coefficients(
+      num_channels,
+      boundaries[0].data(),
+      boundaries[1].data(),
+      boundaries[2].data(),
+      boundaries[3].data(),
+      boundaries[4].data(),
+      boundaries[5].data(),
+      duration
+    );
+    BatchQuinticHermiteInterpolator::Channels positions{};
+    BatchQuinticHermiteInterpolator::Channels velocities{};
+    BatchQuinticHermiteInterpolator::Channels accelerations{};
+    for (size_t end = 0; end < 2; ++end) {
+      interpolator.evaluate(end * duration, positions, velocities, accelerations);
+      for (size_t i = 0; i < num_channels; ++i) {
+        const std::string channel = name + " end " + std::to_string(end) + " channel " +
+          std::to_string(i);
+        test_utils::check_near(positions[i], boundaries[3 * end][i], 1e-9, channel + " position");
+        test_utils::check_near(
+          velocities[i], boundaries[3 * end + 1][i], 1e-9, channel + " velocity"
+        );
+        test_utils::check_near(
+          accelerations[i], boundaries[3 * end + 2][i], 1e-8, channel + " acceleration"
+        );
+      }
+      for (size_t i = num_channels; i < BatchQuinticHermiteInterpolator::MAX_NUM_CHANNELS; ++i) {
+        test_utils::check(
+          positions[i] == 0.0 && velocities[i] == 0.0 && accelerations[i] == 0.0,
+          name + ": unused channel " + std::to_string(i) + " is zero"
+        );
+      }
+    }
+  }
+}
+
+/**
+ * @brief Check a spline path against its waypoints
+ *
+ * @param name Name of the path
+ * @param waypoints Waypoints
+ * @param times Times of the waypoints
+ */
+void check_spline(
+  const std::string & name,
+  const std::vector<std::vector<double>> & waypoints,
+  const std::vector<double> & times
+)
+{
+  CubicSplinePath path(waypoints, times);
+  const size_t n = path.get_num_joints();
+  std::vector<double> positions(n);
+  std::vector<double> velocities(n);
+  std::vector<double> accelerations(n);
+  for (size_t k = 0; k < times.size(); ++k) {
+    path.evaluate(times[k], positions, velocities, accelerations);
+    for (size_t j = 0; j < n; ++j) {
+      const std::string point = name + " waypoint " + std::to_string(k) + " joint " +
+        std::to_string(j);
+      test_utils::check_near(positions[j], waypoints[k][j], 1e-12, point + " position");
+      if (k == 0 || k + 1 == times.size()) {
+        test_utils::check_near(velocities[j], 0.0, 1e-12, point + " velocity");
+        test_utils::check_near(accelerations[j], 0.0, 1e-10, point + " acceleration");
+      }
+    }
+  }
+
+  // Values on both sides of every time differ by at most the next derivative times the gap, the
+  // jerk being bounded
+  constexpr double gap{1e-9};
+  std::vector<double> positions_after(n);
+  std::vector<double> velocities_after(n);
+  std::vector<double> accelerations_after(n);
+  double max_jump{0.0};
+  for (double t = gap; t + gap < path.get_duration(); t += 1e-3) {
+    path.evaluate(t - gap, positions, velocities, accelerations);
+    path.evaluate(t + gap, positions_after, velocities_after, accelerations_after);
+    for (size_t j = 0; j < n; ++j) {
+      max_jump = std::max(
+        {
+          max_jump,
+          std::abs(positions_after[j] - positions[j]),
+          std::abs(velocities_after[j] - velocities[j]),
+          std::abs(accelerations_after[j] - accelerations[j])
+        }
+      );
+    }
+  }
+  test_utils::check(
+    max_jump < 1e-4,
+    name + ": continuity, largest jump " + std::to_string(max_jump)
+  );
+}
+
+void test_spline()
+{
+  check_spline("single segment", {{0.0, 1.0}, {1.0, -2.0}}, {0.0, 1.0});
+  check_spline("two segments", {{0.0, 0.0}, {1.0, 2.0}, {-1.0, 3.0}}, {0.0, 0.5, 2.0});
+  check_spline(
+    "uneven segments",
+    {{0.5}, {1.0}, {2.0}, {-1.0}, {0.0}},
+    {0.0, 0.3, 0.7, 1.5, 1.6}
+  );
+
+  bool thrown{false};
+  try {
+    CubicSplinePath({{0.0}, {1.0}}, {0.0, 0.0});
+  } catch (const trossen_arm::LogicError &) {
+    thrown = true;
+  }
+  test_utils::check(thrown, "spline with non-increasing times is rejected");
+}
+
+}  // namespace
+
+int main()
+{
+  test_quintic_boundaries();
+  test_spline();
+  return test_utils::report("test_interpolation");
+}
@@ -0,0 +1,335 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of ArmKinematics on the standard WXAI V0 chain:
+// 1. Inverse kinematics recovers the configurations whose forward kinematics it is given
+// 2. The Jacobian matches central finite differences of forward kinematics
+// 3. The compile-time structure of Kinematics<Model::wxai_v0> matches the standard joints, and its
+//    results match those of ArmKinematics
+// 4. IncrementalInverseKinematics converges along small steps, reuses the pose and Jacobian cached
+//    at its solution, and continues capped solves
+
+#include <cstddef>
+
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_kinematics.hpp"
+#include "libtrossen_arm/trossen_arm_type.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::ArmKinematics;
+namespace detail = trossen_arm::detail;
+
+// Number of sampled configurations
+constexpr size_t NUM_SAMPLES{100};
+
+/**
+ * @brief Sample configurations of the arm joints away from the singularities
+ *
+ * @return Configurations
+ */
+std::vector<ArmKinematics::JointPositions> sample_joint_positions()
+{
+  const std::array<std::array<double, 2>, ArmKinematics::NUM_ARM_JOINTS> ranges{{
+    {-2.0, 2.0}, {0.3, 1.5}, {0.3, 1.5}, {-1.0, 1.0}, {-1.2, 1.2}, {-2.0, 2.0}
+  }};
+  std::mt19937 generator(42);
+  std::vector<ArmKinematics::JointPositions> samples(NUM_SAMPLES);
+  for (auto & sample : samples) {
+    for (size_t i = 0; i < ArmKinematics::NUM_ARM_JOINTS; ++i) {
+      sample[i] = std::uniform_real_distribution<double>(ranges[i][0], ranges[i][1])(generator);
+    }
+  }
+  return samples;
+}
+
+/**
+ * @brief Get the rotation of Cartesian positions
+ *
+ * @param cartesian_positions Cartesian positions
+ * @return Rotation matrix
+ */
+detail::Matrix3 get_rotation(const ArmKinematics::CartesianPositions & cartesian_positions)
+{
+  return detail::rotation_from_angle_axis(
+    {cartesian_positions[3], cartesian_positions[4], cartesian_positions[5]}
+  );
+}
+
+/**
+ * @brief Get the rotation from one Cartesian positions to another as an angle-axis
+ *
+ * @param from Cartesian positions rotated from
+ * @param to Cartesian positions rotated to
+ * @return Angle-axis of the rotation measured in the base frame
+ */
+detail::Vector3 get_rotation_difference(
+  const ArmKinematics::CartesianPositions & from,
+  const ArmKinematics::CartesianPositions & to
+)
+{
+  return detail::angle_axis_from_rotation(
+    detail::multiply(get_rotation(to), detail::transpose(get_rotation(from)))
+  );
+}
+
+void test_inverse_round_trip(
+  const ArmKinematics & kinematics,
+  const std::vector<ArmKinematics::JointPositions> & samples
+)
+{
+  for (size_t s = 0; s < samples.size(); ++s) {
+    const std::string name = "sample " + std::to_string(s);
+    const ArmKinematics::CartesianPositions goal = kinematics.forward(samples[s]);
+    ArmKinematics::JointPositions seed = samples[s];
+    for (double & position : seed) {
+      position += 0.05;
+    }
+    ArmKinematics::JointPositions joint_positions{};
+    const trossen_arm::InverseKinematicsResult result = kinematics.inverse(
+      goal,
+      seed,
+      joint_positions
+    );
+    test_utils::check(result.success, name + ": inverse kinematics succeeds");
+    const ArmKinematics::CartesianPositions reached = kinematics.forward(joint_positions);
+    for (size_t i = 0; i < 3; ++i) {
+      test_utils::check_near(
+        reached[i], goal[i], 1e-8, name + ": translation " + std::to_string(i)
+      );
+    }
+    const detail::Vector3 rotation_error = get_rotation_difference(goal, reached);
+    test_utils::check_near(
+      std::sqrt(detail::dot(rotation_error, rotation_error)), 0.0, 1e-8, name + ": rotation"
+    );
+    for (size_t i = 0; i < ArmKinematics::NUM_ARM_JOINTS; ++i) {
+      test_utils::check_near(
+        joint_positions[i], samples[s][i], 1e-6, name + ": joint " + std::to_string(i)
+      );
+    }
+  }
+}
+
+void test_jacobian(
+  const ArmKinematics & kinematics,
+  const std::vector<ArmKinematics::JointPositions> & samples
+)
+{
+  constexpr double step{1e-6};
+  for (size_t s = 0; s < samples.size(); ++s) {
+    const ArmKinematics::Jacobian jacobian = kinematics.compute_jacobian(samples[s]);
+    for (size_t j = 0; j < ArmKinematics::NUM_ARM_JOINTS; ++j) {
+      ArmKinematics::JointPositions forward_positions = samples[s];
+      ArmKinematics::JointPositions backward_positions = samples[s];
+      forward_positions[j] += step;
+      backward_positions[j] -= step;
+      const ArmKinematics::CartesianPositions forward = kinematics.forward(forward_positions);
+      const ArmKinematics::CartesianPositions backward = kinematics.forward(backward_positions);
+      const detail::Vector3 rotation = get_rotation_difference(backward, forward);
+      for (size_t r = 0; r < 6; ++r) {
+        const double expected = r < 3 ?
+          (forward[r] - backward[r]) / (2.0 * step) : rotation[r - 3] / (2.0 * step);
+        test_utils::check_near(
+          jacobian[r * ArmKinematics::NUM_ARM_JOINTS + j],
+          expected,
+          1e-6,
+          "sample " + std::to_string(s) + ": Jacobian (" + std::to_string(r) + ", " +
+          std::to_string(j) + ")"
+        );
+      }
+    }
+  }
+}
+
+void test_model_kinematics(
+  const ArmKinematics & kinematics,
+  const std::vector<ArmKinematics::JointPositions> & samples
+)
+{
+  using ModelKinematics = trossen_arm::ModelKinematics<trossen_arm::Model::wxai_v0>;
+  using Kinematics = trossen_arm::Kinematics<trossen_arm::Model::wxai_v0>;
+  const std::vector<trossen_arm::Joint> & joints = trossen_arm::StandardJoints::wxai_v0_20260626;
+
+  // The hand-copied default origins and axes stay in sync with the standard joints
+  test_utils::check(Kinematics::is_compatible(joints), "standard joints match the axes");
+  for (size_t i = 0; i < ModelKinematics::NUM_ARM_JOINTS; ++i) {
+    test_utils::check(
+      ModelKinematics::ORIGINS[i] == joints[i].origin_xyz,
+      "default origin of joint " + std::to_string(i) + " matches the standard joints"
+    );
+  }
+
+  const Kinematics model_kinematics(joints, trossen_arm::StandardEndEffector::wxai_v0_base);
+  for (size_t s = 0; s < samples.size(); ++s) {
+    const std::string name = "sample " + std::to_string(s);
+    Kinematics::Jacobian jacobian{};
+    const Kinematics::CartesianPositions cartesian_positions =
+      model_kinematics.forward(samples[s], jacobian);
+    const ArmKinematics::CartesianPositions expected = kinematics.forward(samples[s]);
+    const ArmKinematics::Jacobian expected_jacobian = kinematics.compute_jacobian(samples[s]);
+    for (size_t i = 0; i < 3; ++i) {
+      test_utils::check_near(
+        cartesian_positions[i],
+        expected[i],
+        1e-12,
+        name + ": model translation " + std::to_string(i)
+      );
+    }
+    const detail::Vector3 rotation_error = get_rotation_difference(expected, cartesian_positions);
+    test_utils::check_near(
+      std::sqrt(detail::dot(rotation_error, rotation_error)), 0.0, 1e-12, name + ": model rotation"
+    );
+    for (size_t i = 0; i < jacobian.size(); ++i) {
+      test_utils::check_near(
+        jacobian[i], expected_jacobian[i], 1e-12, name + ": model Jacobian " + std::to_string(i)
+      );
+    }
+  }
+}
+
+void test_incremental_inverse(
+  const ArmKinematics & kinematics,
+  const std::vector<ArmKinematics::JointPositions> & samples
+)
+{
+  constexpr size_t num_steps{50};
+  constexpr double joint_step{0.002};
+  size_t num_tested{0};
+  for (size_t s = 0; s < samples.size() && num_tested < 10; ++s) {
+    // The steps move every joint by 0.1 rad, so start away from the wrist singularity at joint 4
+    // at 0 and from the elbow stretching out, where two iterations may not reach the tolerances
+    if (std::abs(samples[s][4]) < 0.3 || samples[s][2] > 1.3) {
+      continue;
+    }
+    ++num_tested;
+    const std::string name = "sample " + std::to_string(s);
+    trossen_arm::IncrementalInverseKinematics incremental(kinematics);
+    incremental.reset(samples[s]);
+    ArmKinematics::JointPositions target = samples[s];
+    ArmKinematics::JointPositions joint_positions{};
+    bool converged{true};
+    for (size_t n = 0; n < num_steps; ++n) {
+      for (double & position : target) {
+        position += joint_step;
+      }
+      const trossen_arm::InverseKinematicsResult result =
+        incremental.solve(kinematics.forward(target), joint_positions);
+      converged = converged && result.success;
+    }
+    test_utils::check(converged, name + ": small steps converge from the previous solution");
+    for (size_t i = 0; i < ArmKinematics::NUM_ARM_JOINTS; ++i) {
+      test_utils::check_near(
+        joint_positions[i], target[i], 1e-6, name + ": incremental joint " + std::to_string(i)
+      );
+    }
+    const trossen_arm::IncrementalInverseKinematicsStatistics & statistics =
+      incremental.get_statistics();
+    test_utils::check(statistics.num_solves == num_steps, name + ": number of solves");
+    test_utils::check(statistics.num_converged == num_steps, name + ": number of converged");
+    test_utils::check(statistics.num_capped == 0, name + ": no solve is capped");
+
+    // The pose and Jacobian cached at the solution are reused, so the same goal again takes no
+    // iteration, and the next solve matches a solver restarted at the solution
+    const trossen_arm::InverseKinematicsResult repeated =
+      incremental.solve(kinematics.forward(target), joint_positions);
+    test_utils::check(
+      repeated.success && repeated.num_iterations == 0,
+      name + ": the same goal again is solved from the cache"
+    );
+    ArmKinematics::JointPositions next = target;
+    next[0] += joint_step;
+    trossen_arm::IncrementalInverseKinematics restarted(kinematics);
+    restarted.reset(joint_positions);
+    ArmKinematics::JointPositions cached_solution{};
+    ArmKinematics::JointPositions restarted_solution{};
+    incremental.solve(kinematics.forward(next), cached_solution);
+    restarted.solve(kinematics.forward(next), restarted_solution);
+    test_utils::check(
+      cached_solution == restarted_solution,
+      name + ": the cached Jacobian matches the one at the solution"
+    );
+  }
+  test_utils::check(num_tested == 10, "enough samples away from the singularities");
+
+  // A jump beyond what one iteration can absorb is capped and continued by the next solves
+  trossen_arm::IncrementalInverseKinematics capped(kinematics, 1);
+  capped.reset(samples[0]);
+  ArmKinematics::JointPositions target = samples[0];
+  for (double & position : target) {
+    position += 0.3;
+  }
+  ArmKinematics::JointPositions joint_positions{};
+  const ArmKinematics::CartesianPositions goal = kinematics.forward(target);
+  const trossen_arm::InverseKinematicsResult first = capped.solve(goal, joint_positions);
+  test_utils::check(!first.success, "jump is not solved in one iteration");
+  test_utils::check(first.num_iterations == 1, "solve stops at the iteration cap");
+  test_utils::check(capped.get_statistics().num_capped == 1, "capped solve is counted");
+  test_utils::check(joint_positions != samples[0], "capped solve returns its progress");
+  bool converged{false};
+  for (size_t n = 0; n < 20 && !converged; ++n) {
+    converged = capped.solve(goal, joint_positions).success;
+  }
+  test_utils::check(converged, "next solves continue from the capped solution");
+  test_utils::check(capped.get_statistics().max_iterations == 1, "cap holds for every solve");
+
+  capped.reset_statistics();
+  test_utils::check(capped.get_statistics().num_solves == 0, "statistics are reset");
+
+  bool thrown{false};
+  try {
+    trossen_arm::IncrementalInverseKinematics invalid(kinematics, 0);
+  } catch (const trossen_arm::LogicError &) {
+    thrown = true;
+  }
+  test_utils::check(thrown, "zero iteration cap is rejected");
+}
+
+}  // namespace
+
+int main()
+{
+  const ArmKinematics kinematics(
+    trossen_arm::StandardJoints::wxai_v0_20260626,
+    trossen_arm::StandardEndEffector::wxai_v0_base
+  );
+  const std::vector<ArmKinematics::JointPositions> samples = sample_joint_positions();
+  test_utils::check(kinematics.has_analytic_solution(), "closed-form inverse kinematics is used");
+  test_inverse_round_trip(kinematics, samples);
+  test_jacobian(kinematics, samples);
+  test_model_kinematics(kinematics, samples);
+  test_incremental_inverse(kinematics, samples);
+  return test_utils::report("test_kinematics");
+}
@@ -0,0 +1,157 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of LatencyHistogram:
+// 1. Values below 2 * SUB_BUCKET_COUNT ns are exact, and larger ones are reported as the highest
+//    value of their bucket, within the relative error bound
+// 2. Percentiles at the edges between buckets select the bucket holding the rank
+// 3. Negative values are recorded as zero and values beyond the range are clamped
+
+#include <cstddef>
+#include <cstdint>
+
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_statistics.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::LatencyHistogram;
+
+/**
+ * @brief Convert a whole number of nanoseconds to a sample that truncates back to it
+ *
+ * @param value_ns Value in ns
+ * @return Sample in s
+ */
+double to_sample(uint64_t value_ns)
+{
+  return (static_cast<double>(value_ns) + 0.5) * 1e-9;
+}
+
+/**
+ * @brief Get the highest value of the bucket holding a value, independently of the histogram
+ *
+ * @param value_ns Value in ns
+ * @return Highest value in ns
+ */
+uint64_t get_expected_upper_value(uint64_t value_ns)
+{
+  uint64_t width{1};
+  while (value_ns / width >= 2 * LatencyHistogram::SUB_BUCKET_COUNT) {
+    width *= 2;
+  }
+  return (value_ns / width + 1) * width - 1;
+}
+
+void test_bucket_boundaries()
+{
+  const std::vector<uint64_t> values{
+    0, 1, 63, 64, 127, 128, 129, 130, 131, 255, 256, 259, 260, 1000, 1023, 1024, 123456789
+  };
+  for (uint64_t value : values) {
+    const std::string name = std::to_string(value) + " ns";
+    // A larger sample keeps the reported bucket from being clamped to the maximum
+    LatencyHistogram histogram;
+    histogram.record(to_sample(value));
+    histogram.record(1.0);
+    const uint64_t upper = get_expected_upper_value(value);
+    test_utils::check_near(
+      histogram.get_percentile(50.0) * 1e9, static_cast<double>(upper), 1e-6, name + " bucket"
+    );
+    if (value < 2 * LatencyHistogram::SUB_BUCKET_COUNT) {
+      test_utils::check(upper == value, name + " is exact");
+    }
+    test_utils::check(
+      upper - value <= value / LatencyHistogram::SUB_BUCKET_COUNT,
+      name + " within the relative error bound"
+    );
+  }
+  // The first value of a bucket and the last one of the previous bucket are reported apart
+  LatencyHistogram histogram;
+  histogram.record(to_sample(129));
+  histogram.record(to_sample(130));
+  test_utils::check_near(histogram.get_percentile(50.0) * 1e9, 129.0, 1e-6, "129 ns bucket");
+  test_utils::check_near(histogram.get_percentile(51.0) * 1e9, 130.0, 1e-6, "130 ns bucket");
+}
+
+void test_percentile_edges()
+{
+  // 999 samples in one bucket and 1 in another, so that the 99.9th percentile is the last
+  // sample of the lower bucket
+  LatencyHistogram histogram;
+  histogram.record(to_sample(1000), 999);
+  histogram.record(to_sample(5000));
+  const double lower = get_expected_upper_value(1000) * 1e-9;
+  test_utils::check_near(histogram.get_percentile(99.9), lower, 1e-15, "99.9th at the edge");
+  // The upper bucket is reported clamped to the maximum sample
+  test_utils::check_near(histogram.get_percentile(99.95), 5000e-9, 1e-15, "above the edge");
+  test_utils::check_near(histogram.get_percentile(0.0), lower, 1e-15, "0th is the lowest bucket");
+  test_utils::check_near(histogram.get_percentile(100.0), 5000e-9, 1e-15, "100th is the maximum");
+  test_utils::check_near(histogram.get_percentile(150.0), 5000e-9, 1e-15, "beyond 100 clamps");
+
+  const trossen_arm::LatencySummary summary = histogram.get_summary();
+  test_utils::check(summary.count == 1000, "summary count");
+  test_utils::check_near(summary.p999, lower, 1e-15, "summary 99.9th at the edge");
+  test_utils::check_near(summary.min, 1000e-9, 1e-15, "summary minimum");
+  test_utils::check_near(summary.max, 5000e-9, 1e-15, "summary maximum");
+  test_utils::check_near(summary.mean, (999 * 1000e-9 + 5000e-9) / 1000, 1e-15, "summary mean");
+
+  histogram.reset();
+  test_utils::check(histogram.get_summary().count == 0, "reset clears the samples");
+  test_utils::check(histogram.get_percentile(50.0) == 0.0, "empty percentile is zero");
+  histogram.record(1.0, 0);
+  test_utils::check(histogram.get_summary().count == 0, "zero count records nothing");
+}
+
+void test_overflow()
+{
+  const double max_value = ((uint64_t{1} << LatencyHistogram::MAX_MAGNITUDE) - 1) * 1e-9;
+  LatencyHistogram histogram;
+  histogram.record(-1.0);
+  histogram.record(1e6);
+  const trossen_arm::LatencySummary summary = histogram.get_summary();
+  test_utils::check(summary.min == 0.0, "negative sample is recorded as zero");
+  test_utils::check_near(summary.max, max_value, 1e-9, "large sample is clamped to the range");
+  test_utils::check_near(histogram.get_percentile(100.0), max_value, 1e-9, "clamped percentile");
+  test_utils::check_near(summary.mean, 0.5 * max_value, 1e-9, "mean of the clamped samples");
+}
+
+}  // namespace
+
+int main()
+{
+  test_bucket_boundaries();
+  test_percentile_edges();
+  test_overflow();
+  return test_utils::report("test_statistics");
+}
@@ -0,0 +1,241 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Purpose:
+// Unit tests of the streaming components:
+// 1. SpscQueue rounds its capacity up, refuses to pop when empty and to push when full, and keeps
+//    the order of the elements across wraparounds
+// 2. TrajectoryPlayer counts an underrun when the queue runs dry and brakes moving joints to rest
+//    half the segment duration times the velocity past the last waypoint
+// 3. TrajectoryPlayer discards the waypoints appended before a collision
+
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "libtrossen_arm/trossen_arm_collision.hpp"
+#include "libtrossen_arm/trossen_arm_streaming.hpp"
+#include "test_utils.hpp"
+
+namespace
+{
+
+using trossen_arm::BatchQuinticHermiteInterpolator;
+using trossen_arm::SpscQueue;
+using trossen_arm::StreamWaypoint;
+using trossen_arm::TrajectoryPlayer;
+
+// Time step of the player in s
+constexpr double TIME_STEP{0.01};
+
+/**
+ * @brief Make a waypoint
+ *
+ * @param positions Positions of the joints
+ * @param duration Duration of the segment in s
+ * @param epoch Number of collision faults cleared
+ * @return Waypoint with estimated velocities
+ */
+StreamWaypoint make_waypoint(
+  const std::vector<double> & positions,
+  double duration,
+  uint64_t epoch = 0
+)
+{
+  StreamWaypoint waypoint;
+  std::copy(positions.begin(), positions.end(), waypoint.positions.begin());
+  waypoint.duration = duration;
+  waypoint.epoch = epoch;
+  return waypoint;
+}
+
+void test_queue()
+{
+  SpscQueue<int> queue(3);
+  test_utils::check(queue.capacity() == 4, "queue capacity is rounded up to a power of two");
+  int value{-1};
+  test_utils::check(!queue.try_pop(value), "empty queue pops nothing");
+  test_utils::check(value == -1, "empty queue leaves the value untouched");
+
+  for (int i = 0; i < 4; ++i) {
+    test_utils::check(queue.try_push(i), "push " + std::to_string(i) + " into a non-full queue");
+  }
+  test_utils::check(!queue.try_push(4), "full queue refuses a push");
+  test_utils::check(queue.size() == 4, "full queue size");
+  for (int i = 0; i < 4; ++i) {
+    test_utils::check(queue.try_pop(value) && value == i, "pop " + std::to_string(i) + " in order");
+  }
+  test_utils::check(!queue.try_pop(value), "drained queue pops nothing");
+
+  // Push and pop three elements at a time so that the indices wrap around the slots many times
+  int next_push{0};
+  int next_pop{0};
+  for (int round = 0; round < 10; ++round) {
+    for (int i = 0; i < 3; ++i) {
+      test_utils::check(queue.try_push(next_push++), "push across the wraparound");
+    }
+    test_utils::check(queue.size() == 3, "size across the wraparound");
+    for (int i = 0; i < 3; ++i) {
+      test_utils::check(
+        queue.try_pop(value) && value == next_pop++,
+        "pop in order across the wraparound"
+      );
+    }
+  }
+  test_utils::check(queue.size() == 0, "queue is empty after the wraparounds");
+}
+
+void test_underrun_braking()
+{
+  constexpr double duration{0.2};
+  const std::vector<double> goal_positions{0.1, -0.2};
+  const std::vector<double> goal_velocities{0.5, -1.0};
+  TrajectoryPlayer player({0.0, 0.0});
+  SpscQueue<StreamWaypoint> queue(4);
+  StreamWaypoint waypoint = make_waypoint(goal_positions, duration);
+  std::copy(goal_velocities.begin(), goal_velocities.end(), waypoint.velocities.begin());
+  waypoint.has_velocities = true;
+  queue.try_push(waypoint);
+
+  BatchQuinticHermiteInterpolator::Channels positions{};
+  BatchQuinticHermiteInterpolator::Channels velocities{};
+  BatchQuinticHermiteInterpolator::Channels accelerations{};
+  BatchQuinticHermiteInterpolator::Channels underrun_velocities{};
+  size_t num_underruns{0};
+  for (size_t n = 0; n < 60; ++n) {
+    if (player.step(queue, 0, positions, velocities, accelerations).underrun) {
+      ++num_underruns;
+      underrun_velocities = velocities;
+    }
+    player.advance(TIME_STEP);
+  }
+  test_utils::check(num_underruns == 1, "one underrun when the queue runs dry");
+  for (size_t i = 0; i < 2; ++i) {
+    const std::string name = "joint " + std::to_string(i);
+    test_utils::check_near(
+      positions[i],
+      goal_positions[i] + 0.5 * goal_velocities[i] * duration,
+      1e-12,
+      name + " brakes to rest half the duration times the velocity past the waypoint"
+    );
+    test_utils::check_near(velocities[i], 0.0, 1e-12, name + " velocity at rest");
+    test_utils::check_near(accelerations[i], 0.0, 1e-12, name + " acceleration at rest");
+    // The braking starts from the waypoint velocity and decelerates by at most 1.5 times the
+    // velocity over the duration, so it is at most one time step into the braking
+    test_utils::check_near(
+      underrun_velocities[i],
+      goal_velocities[i],
+      1.5 * std::abs(goal_velocities[i]) / duration * TIME_STEP,
+      name + " braking starts from the waypoint velocity"
+    );
+  }
+
+  // An underrun at rest holds the waypoint without braking
+  TrajectoryPlayer resting_player({0.0, 0.0});
+  StreamWaypoint resting_waypoint = make_waypoint(goal_positions, duration);
+  resting_waypoint.has_velocities = true;
+  queue.try_push(resting_waypoint);
+  num_underruns = 0;
+  for (size_t n = 0; n < 60; ++n) {
+    num_underruns += resting_player.step(queue, 0, positions, velocities, accelerations).underrun;
+    resting_player.advance(TIME_STEP);
+  }
+  test_utils::check(num_underruns == 1, "one underrun at rest");
+  for (size_t i = 0; i < 2; ++i) {
+    test_utils::check_near(
+      positions[i],
+      goal_positions[i],
+      1e-12,
+      "joint " + std::to_string(i) + " holds the waypoint reached at rest"
+    );
+  }
+}
+
+void test_stale_epoch()
+{
+  // The workspace ceiling is cleared at the zero configuration but not with the arm raised
+  trossen_arm::CollisionCheckerConfiguration configuration;
+  configuration.workspace_max[2] = 0.25;
+  const trossen_arm::CollisionChecker collision_checker(
+    trossen_arm::StandardJoints::wxai_v0_20260626,
+    trossen_arm::StandardEndEffector::wxai_v0_base,
+    configuration
+  );
+  test_utils::check(collision_checker.check({}).is_safe(), "zero configuration is clear");
+  const std::vector<double> zeros(7, 0.0);
+  TrajectoryPlayer player(zeros, collision_checker);
+  SpscQueue<StreamWaypoint> queue(4);
+  queue.try_push(make_waypoint({0.0, 0.5, 0.5, 0.0, 0.0, 0.0, 0.0}, 0.5));
+  queue.try_push(make_waypoint({0.1, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, 0.5));
+
+  BatchQuinticHermiteInterpolator::Channels positions{};
+  BatchQuinticHermiteInterpolator::Channels velocities{};
+  BatchQuinticHermiteInterpolator::Channels accelerations{};
+  bool collided{false};
+  for (size_t n = 0; n < 50 && !collided; ++n) {
+    collided = player.step(queue, 0, positions, velocities, accelerations).collision;
+    player.advance(TIME_STEP);
+  }
+  test_utils::check(collided, "raising the arm into the ceiling collides");
+  const BatchQuinticHermiteInterpolator::Channels held_positions = positions;
+
+  // The fault is not cleared yet, so the epoch stays 0 and the queued waypoint is stale
+  for (size_t n = 0; n < 100; ++n) {
+    player.step(queue, 0, positions, velocities, accelerations);
+    player.advance(TIME_STEP);
+  }
+  test_utils::check(queue.size() == 0, "waypoint appended before the collision is popped");
+  test_utils::check(
+    positions == held_positions,
+    "waypoint appended before the collision is discarded"
+  );
+
+  // A waypoint appended after the fault is cleared is played, reaching it at rest
+  StreamWaypoint waypoint = make_waypoint({0.2, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, 0.5, 1);
+  waypoint.has_velocities = true;
+  queue.try_push(waypoint);
+  for (size_t n = 0; n < 100; ++n) {
+    player.step(queue, 1, positions, velocities, accelerations);
+    player.advance(TIME_STEP);
+  }
+  test_utils::check_near(positions[0], 0.2, 1e-12, "waypoint appended after clearing is played");
+}
+
+}  // namespace
+
+int main()
+{
+  test_queue();
+  test_underrun_braking();
+  test_stale_epoch();
+  return test_utils::report("test_streaming");
+}
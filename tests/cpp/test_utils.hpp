@@ -0,0 +1,106 @@
+// Copyright 2025 Trossen Robotics
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright
+//      notice, this list of conditions and the following disclaimer in the
+//      documentation and/or other materials provided with the distribution.
+//
+//    * Neither the name of the the copyright holder nor the names of its
+//      contributors may be used to endorse or promote products derived from
+//      this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Minimal checks shared by the unit tests, which need no test framework
+
+#ifndef TESTS__TEST_UTILS_HPP_
+#define TESTS__TEST_UTILS_HPP_
+
+#include <cmath>
+#include <iostream>
+#include <string>
+
+namespace test_utils
+{
+
+/**
+ * @brief Get the number of failed checks
+ *
+ * @return Reference to the number of failed checks
+ */
+inline int & num_failures()
+{
+  static int num_failures{0};
+  return num_failures;
+}
+
+/**
+ * @brief Check a condition
+ *
+ * @param condition Condition expected to hold
+ * @param message Description printed if the condition does not hold
+ */
+inline void check(bool condition, const std::string & message)
+{
+  if (!condition) {
+    std::cerr << "FAILED: " << message << std::endl;
+    ++num_failures();
+  }
+}
+
+/**
+ * @brief Check that a value is near its expected value
+ *
+ * @param actual Value
+ * @param expected Expected value
+ * @param tolerance Largest absolute difference
+ * @param message Description printed if the values differ
+ */
+inline void check_near(
+  double actual,
+  double expected,
+  double tolerance,
+  const std::string & message
+)
+{
+  if (!(std::abs(actual - expected) <= tolerance)) {
+    std::cerr << "FAILED: " << message << ": " << actual << " != " << expected << " within "
+              << tolerance << std::endl;
+    ++num_failures();
+  }
+}
+
+/**
+ * @brief Report the failed checks
+ *
+ * @param name Name of the test
+ * @return Exit status, 0 if no check failed
+ */
+inline int report(const std::string & name)
+{
+  if (num_failures() > 0) {
+    std::cerr << name << ": " << num_failures() << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << name << ": all checks passed" << std::endl;
+  return 0;
+}
+
+}  // namespace test_utils
+
+#endif  // TESTS__TEST_UTILS_HPP_